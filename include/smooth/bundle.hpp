@@ -79,6 +79,11 @@ public:
   template<std::size_t Idx>
   static constexpr auto PartDof = Impl::Dofs[Idx];
 
+  /**
+   * @brief Block-diagonal tangent map type with one block per part.
+   */
+  using TangentMapBlockDiag = typename Impl::TangentMapBlockDiag;
+
   /**
    * @brief Access part no Idx of Bundle.
    */
@@ -98,6 +103,44 @@ public:
     return MapDispatch<const PartType<Idx>>(
       static_cast<const _Derived &>(*this).data() + std::get<Idx>(Impl::RepSizesPsum));
   }
+
+  /**
+   * @brief Lie group adjoint in block-diagonal form.
+   *
+   * Same as Ad() but only the diagonal blocks are computed and stored.
+   */
+  TangentMapBlockDiag Ad_blockdiag() const noexcept
+  {
+    TangentMapBlockDiag ret;
+    Impl::Ad_blockdiag(static_cast<const _Derived &>(*this).coeffs(), ret);
+    return ret;
+  }
+
+  /**
+   * @brief Right jacobian of the exponential map in block-diagonal form.
+   *
+   * Same as dr_exp() but only the diagonal blocks are computed and stored.
+   */
+  template<typename TangentDerived>
+  static TangentMapBlockDiag dr_exp_blockdiag(const Eigen::MatrixBase<TangentDerived> & a) noexcept
+  {
+    TangentMapBlockDiag ret;
+    Impl::dr_exp_blockdiag(a, ret);
+    return ret;
+  }
+
+  /**
+   * @brief Inverse of right jacobian of the exponential map in block-diagonal form.
+   *
+   * Same as dr_expinv() but only the diagonal blocks are computed and stored.
+   */
+  template<typename TangentDerived>
+  static TangentMapBlockDiag dr_expinv_blockdiag(const Eigen::MatrixBase<TangentDerived> & a) noexcept
+  {
+    TangentMapBlockDiag ret;
+    Impl::dr_expinv_blockdiag(a, ret);
+    return ret;
+  }
 };
 
 /// Type for which liebase_info is properly specified.
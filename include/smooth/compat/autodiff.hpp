@@ -110,6 +110,129 @@ auto dr_autodiff(auto && f, auto && x)
   }
 }
 
+/**
+ * @brief Hessian-vector product in tangent space using the autodiff library.
+ *
+ * Forward-over-forward differentiation where the outer direction is seeded with v, which requires
+ * dof(x) evaluations of f with second-order duals.
+ *
+ * @param f function to differentiate
+ * @param x reference tuple of function arguments
+ * @param v direction (must be of size dof(x))
+ * @return \p std::tuple containing value, right derivative, and Hessian-vector product
+ */
+auto dr_autodiff_hvp(auto && f, auto && x, const auto & v)
+{
+  using Result = decltype(std::apply(f, x));
+  using Scalar = ::smooth::Scalar<Result>;
+  using Eigen::Matrix;
+
+  static_assert(Manifold<Result>, "f(x) is not a Manifold");
+
+  using AdScalar = autodiff::HigherOrderDual<2, Scalar>;
+
+  Result F = std::apply(f, x);
+
+  static constexpr auto Nx = wrt_Dof<decltype(x)>();
+  static constexpr auto Ny = Dof<Result>;
+  const Eigen::Index nx    = std::apply([](auto &&... args) { return (dof(args) + ...); }, x);
+  const Eigen::Index ny    = dof(F);
+
+  // cast F, x, and v to ad types
+  const auto x_ad                    = wrt_cast<AdScalar>(x);
+  CastT<AdScalar, Result> F_ad       = cast<AdScalar>(F);
+  const Matrix<AdScalar, Nx, 1> v_ad = v.template cast<AdScalar>();
+
+  // function to differentiate
+  const auto f_ad =
+    [&f, &x_ad, &F_ad, &v_ad](AdScalar & t, Matrix<AdScalar, Nx, 1> & var) -> Matrix<AdScalar, Ny, 1> {
+    return rminus(std::apply(f, wrt_rplus(wrt_rplus(x_ad, (t * v_ad).eval()), var)), F_ad);
+  };
+
+  Matrix<Scalar, Ny, Nx> J(ny, nx);
+  Matrix<Scalar, Nx, Ny> Hv(nx, ny);
+
+  // zero-valued tangent elements
+  AdScalar t_ad                = 0;
+  Matrix<AdScalar, Nx, 1> a_ad = Matrix<AdScalar, Nx, 1>::Zero(nx);
+
+  autodiff::detail::ForEachWrtVar(autodiff::wrt(a_ad), [&](auto && j, auto && xj) constexpr {
+    const auto u = autodiff::detail::eval(f_ad, autodiff::at(t_ad, a_ad), autodiff::wrt(xj, t_ad));
+    for (auto k = 0u; k < ny; ++k) {
+      J(k, j)  = static_cast<Scalar>(autodiff::detail::derivative<1>(u[k]));
+      Hv(j, k) = static_cast<Scalar>(autodiff::detail::derivative<2>(u[k]));
+    }
+  });
+
+  return std::make_tuple(std::move(F), std::move(J), std::move(Hv));
+}
+
+/**
+ * @brief Block-diagonal Hessian approximation in tangent space using the autodiff library.
+ *
+ * @tparam B block size
+ *
+ * @param f function to differentiate
+ * @param x reference tuple of function arguments
+ * @return \p std::tuple containing value, right derivative, and stacked diagonal Hessian blocks
+ */
+template<std::size_t B>
+  requires(B >= 1)
+auto dr_autodiff_blockdiag(auto && f, auto && x)
+{
+  using Result = decltype(std::apply(f, x));
+  using Scalar = ::smooth::Scalar<Result>;
+  using Eigen::Matrix;
+
+  static_assert(Manifold<Result>, "f(x) is not a Manifold");
+
+  using AdScalar = autodiff::HigherOrderDual<2, Scalar>;
+
+  Result F = std::apply(f, x);
+
+  static constexpr auto Nx = wrt_Dof<decltype(x)>();
+  static constexpr auto Ny = Dof<Result>;
+  static constexpr auto Nb = static_cast<Eigen::Index>(B);
+  const Eigen::Index nx    = std::apply([](auto &&... args) { return (dof(args) + ...); }, x);
+  const Eigen::Index ny    = dof(F);
+
+  // cast F and x to ad types
+  const auto x_ad              = wrt_cast<AdScalar>(x);
+  CastT<AdScalar, Result> F_ad = cast<AdScalar>(F);
+
+  // function to differentiate
+  const auto f_ad =
+    [&f, &x_ad, &F_ad](Matrix<AdScalar, Nx, 1> & var1, Matrix<AdScalar, Nx, 1> & var2) -> Matrix<AdScalar, Ny, 1> {
+    return rminus(std::apply(f, wrt_rplus(wrt_rplus(x_ad, var1), var2)), F_ad);
+  };
+
+  Matrix<Scalar, Ny, Nx> J(ny, nx);
+  Matrix<Scalar, Nx, Ny == -1 ? -1 : static_cast<int>(B) * Ny> Hb(nx, Nb * ny);
+  Hb.setZero();
+
+  // zero-valued tangent elements
+  Matrix<AdScalar, Nx, 1> a_ad1 = Matrix<AdScalar, Nx, 1>::Zero(nx);
+  Matrix<AdScalar, Nx, 1> a_ad2 = Matrix<AdScalar, Nx, 1>::Zero(nx);
+
+  const auto a_wrt1 = autodiff::wrt(a_ad1);
+  const auto a_wrt2 = autodiff::wrt(a_ad2);
+
+  autodiff::detail::ForEachWrtVar(a_wrt1, [&](auto && i, auto && xi) constexpr {
+    autodiff::detail::ForEachWrtVar(a_wrt2, [&](auto && j, auto && xj) constexpr {
+      const auto bi = static_cast<Eigen::Index>(i) / Nb;
+      const auto bj = static_cast<Eigen::Index>(j) / Nb;
+      if (bi != bj) { return; }  // outside of diagonal blocks
+      const auto u = autodiff::detail::eval(f_ad, autodiff::at(a_ad1, a_ad2), autodiff::wrt(xi, xj));
+      for (auto k = 0u; k < ny; ++k) {
+        J(k, i)                     = static_cast<Scalar>(autodiff::detail::derivative<1>(u[k]));
+        Hb(j, k * Nb + i - bi * Nb) = static_cast<Scalar>(autodiff::detail::derivative<2>(u[k]));
+      }
+    });
+  });
+
+  return std::make_tuple(std::move(F), std::move(J), std::move(Hb));
+}
+
 }  // namespace diff
 
 SMOOTH_END_NAMESPACE
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <tuple>
 #include <utility>
 
 #include <Eigen/Core>
@@ -124,6 +125,16 @@ struct man<G>
     return traits::lie<G>::composition(g, traits::lie<G>::exp(a));
   }
 
+  template<typename Derived>
+  static inline void rplus_assign(G & g, const Eigen::MatrixBase<Derived> & a)
+  {
+    if constexpr (requires { traits::lie<G>::rplus_assign(g, a); }) {
+      traits::lie<G>::rplus_assign(g, a);
+    } else {
+      g = traits::lie<G>::composition(g, traits::lie<G>::exp(a));
+    }
+  }
+
   template<LieGroup Go = G>
   static inline Eigen::Matrix<Scalar, Dof, 1> rminus(const G & g1, const Go & g2)
   {
@@ -316,6 +327,98 @@ inline Tangent<G> lminus(const G & g1, const Go & g2)
   return log(composition(g1, inverse(g2)));
 }
 
+/**
+ * @brief Lie algebra exponential together with its right Jacobian
+ *
+ * Dispatches to a fused implementation in traits::lie<G> when available (all native Lie groups
+ * provide one that evaluates shared trigonometric terms once).
+ *
+ * @return pair (exp(a), dr_exp(a))
+ */
+template<LieGroup G, typename Derived>
+inline std::pair<PlainObject<G>, TangentMap<G>> exp_with_dr_exp(const Eigen::MatrixBase<Derived> & a)
+{
+  if constexpr (requires { traits::lie<G>::exp_with_dr_exp(a); }) {
+    return traits::lie<G>::exp_with_dr_exp(a);
+  } else {
+    return {::smooth::exp<G>(a), dr_exp<G>(a)};
+  }
+}
+
+/**
+ * @brief Group logarithm together with the inverse right Jacobian of exp at the logarithm
+ *
+ * Dispatches to a fused implementation in traits::lie<G> when available (all native Lie groups
+ * provide one that evaluates shared trigonometric terms once).
+ *
+ * @return pair (log(g), dr_expinv(log(g)))
+ */
+template<LieGroup G>
+inline std::pair<Tangent<G>, TangentMap<G>> log_with_dr_expinv(const G & g)
+{
+  if constexpr (requires { traits::lie<G>::log_with_dr_expinv(g); }) {
+    return traits::lie<G>::log_with_dr_expinv(g);
+  } else {
+    Tangent<G> a = log(g);
+    return {a, dr_expinv<G>(a)};
+  }
+}
+
+/**
+ * @brief Between-residual rminus(g1^-1 * g2, z) together with its right Jacobians w.r.t. g1 and g2
+ *
+ * Dispatches to a fused implementation in traits::lie<G> when available (SO3, SE2, SE3 and Galilei
+ * provide one that shares rotation matrices between residual and Jacobians).
+ *
+ * @return tuple (r, dr r / dg1, dr r / dg2)
+ */
+template<LieGroup G>
+inline std::tuple<Tangent<G>, TangentMap<G>, TangentMap<G>> between_rminus(const G & g1, const G & g2, const G & z)
+{
+  if constexpr (requires { traits::lie<G>::between_rminus(g1, g2, z); }) {
+    return traits::lie<G>::between_rminus(g1, g2, z);
+  } else {
+    const PlainObject<G> d = composition(inverse(g1), g2);
+    auto [r, J2]           = log_with_dr_expinv(composition(inverse(z), d));
+    TangentMap<G> J1       = -J2 * Ad(inverse(d));
+    return {std::move(r), std::move(J1), std::move(J2)};
+  }
+}
+
+/**
+ * @brief Covariance transport with the group adjoint \f$ Ad_g P Ad_g^T \f$
+ *
+ * Dispatches to an implementation in traits::lie<G> when available (SE3, SE_K_3 and Galilei
+ * provide one that skips the zero blocks of \f$ Ad_g \f$).
+ */
+template<LieGroup G, typename Derived>
+inline TangentMap<G> Ad_cov(const G & g, const Eigen::MatrixBase<Derived> & P)
+{
+  if constexpr (requires { traits::lie<G>::Ad_cov(g, P); }) {
+    return traits::lie<G>::Ad_cov(g, P);
+  } else {
+    const TangentMap<G> A = Ad(g);
+    return A * P * A.transpose();
+  }
+}
+
+/**
+ * @brief Covariance transport with the right Jacobian of the exponential map \f$ J P J^T \f$
+ *
+ * Dispatches to an implementation in traits::lie<G> when available (SE3, SE_K_3 and Galilei
+ * provide one that skips the zero blocks of the Jacobian).
+ */
+template<LieGroup G, typename Derived1, typename Derived2>
+inline TangentMap<G> dr_exp_cov(const Eigen::MatrixBase<Derived1> & a, const Eigen::MatrixBase<Derived2> & P)
+{
+  if constexpr (requires { traits::lie<G>::dr_exp_cov(a, P); }) {
+    return traits::lie<G>::dr_exp_cov(a, P);
+  } else {
+    const TangentMap<G> J = dr_exp<G>(a);
+    return J * P * J.transpose();
+  }
+}
+
 /**
  * @brief Left Jacobian of exponential map
  */
@@ -26,6 +26,12 @@ struct man;
 
 /**
  * @brief Class-external Manifold interface defined through the traits::man trait class.
+ *
+ * Optionally, traits::man<M> can define an in-place right-plus
+ * \code
+ *   static void rplus_assign(M & m, const Eigen::MatrixBase<Derived> & a);
+ * \endcode
+ * which is used by rplus_assign() to avoid creating a new object.
  */
 template<typename M>
 concept Manifold =
@@ -165,6 +171,21 @@ inline PlainObject<M> rplus(const M & m, const Eigen::MatrixBase<Derived> & a)
   return traits::man<M>::rplus(m, a);
 }
 
+/**
+ * @brief Manifold in-place right-plus
+ *
+ * Calls traits::man<M>::rplus_assign() if it exists, and otherwise assigns m = rplus(m, a).
+ */
+template<Manifold M, typename Derived>
+inline void rplus_assign(M & m, const Eigen::MatrixBase<Derived> & a)
+{
+  if constexpr (requires { traits::man<M>::rplus_assign(m, a); }) {
+    traits::man<M>::rplus_assign(m, a);
+  } else {
+    m = traits::man<M>::rplus(m, a);
+  }
+}
+
 /**
  * @brief Manifold right-minus
  */
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+/**
+ * @file
+ * @brief Batched covariance transport through the adjoint and the right jacobian of exp.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <ranges>
+
+#include "concepts/lie_group.hpp"
+#include "detail/parallel.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief Batched covariance transport with the group adjoint.
+ *
+ * Computes \f$ P^{out}_i = \mathbf{Ad}_{g_i} P_i \mathbf{Ad}_{g_i}^T \f$ for all i. Groups that
+ * provide a block-structured kernel (SE3, SE_K_3, Galilei) skip the zero blocks of the adjoint.
+ * Batches are split over threads.
+ *
+ * @param gs range of group elements
+ * @param Ps range of covariances with the same size as gs
+ * @param out output range with the same size as gs, may be the same range as Ps
+ * @param num_threads maximum number of threads (0 means std::thread::hardware_concurrency())
+ */
+template<std::ranges::random_access_range RG, std::ranges::random_access_range RP, std::ranges::random_access_range RO>
+  requires(LieGroup<std::ranges::range_value_t<RG>> && std::ranges::sized_range<RG>)
+void Ad_cov_batch(const RG & gs, const RP & Ps, RO && out, std::size_t num_threads = 0)
+{
+  const auto N = static_cast<std::size_t>(std::ranges::size(gs));
+
+  assert(static_cast<std::size_t>(std::ranges::size(Ps)) == N);
+  assert(static_cast<std::size_t>(std::ranges::size(out)) == N);
+
+  const std::size_t C = detail::parallel_num_chunks(N, num_threads, 256);
+  detail::parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t) {
+    for (auto i = static_cast<std::ptrdiff_t>(b); i < static_cast<std::ptrdiff_t>(e); ++i) {
+      std::ranges::begin(out)[i] = Ad_cov(std::ranges::begin(gs)[i], std::ranges::begin(Ps)[i]);
+    }
+  });
+}
+
+/**
+ * @brief Batched covariance transport with the right jacobian of the exponential map.
+ *
+ * Computes \f$ P^{out}_i = \mathrm{d}^r \exp_{a_i} P_i \left( \mathrm{d}^r \exp_{a_i} \right)^T \f$
+ * for all i. Groups that provide a block-structured kernel (SE3, SE_K_3, Galilei) skip the zero
+ * blocks of the jacobian. Batches are split over threads.
+ *
+ * @tparam G Lie group type
+ * @param as range of tangent elements
+ * @param Ps range of covariances with the same size as as
+ * @param out output range with the same size as as, may be the same range as Ps
+ * @param num_threads maximum number of threads (0 means std::thread::hardware_concurrency())
+ */
+template<
+  LieGroup G,
+  std::ranges::random_access_range RA,
+  std::ranges::random_access_range RP,
+  std::ranges::random_access_range RO>
+  requires(std::ranges::sized_range<RA>)
+void dr_exp_cov_batch(const RA & as, const RP & Ps, RO && out, std::size_t num_threads = 0)
+{
+  const auto N = static_cast<std::size_t>(std::ranges::size(as));
+
+  assert(static_cast<std::size_t>(std::ranges::size(Ps)) == N);
+  assert(static_cast<std::size_t>(std::ranges::size(out)) == N);
+
+  const std::size_t C = detail::parallel_num_chunks(N, num_threads, 256);
+  detail::parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t) {
+    for (auto i = static_cast<std::ptrdiff_t>(b); i < static_cast<std::ptrdiff_t>(e); ++i) {
+      std::ranges::begin(out)[i] = dr_exp_cov<G>(std::ranges::begin(as)[i], std::ranges::begin(Ps)[i]);
+    }
+  });
+}
+
+SMOOTH_END_NAMESPACE
@@ -3,11 +3,14 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <tuple>
+#include <type_traits>
 
 #include <Eigen/Core>
 
 #include "common.hpp"
+#include "tn.hpp"
 #include "utils.hpp"
 
 /**
@@ -21,6 +24,101 @@ SMOOTH_BEGIN_NAMESPACE
 
 using std::get;
 
+namespace detail {
+
+/// @brief True for Euclidean (TnImpl) implementations.
+template<typename T>
+struct is_tn_impl : std::false_type
+{};
+
+template<int N, typename Scalar>
+struct is_tn_impl<TnImpl<N, Scalar>> : std::true_type
+{};
+
+}  // namespace detail
+
+/**
+ * @brief Block-diagonal square matrix with square blocks of sizes Ns...
+ *
+ * Only the diagonal blocks are stored.
+ */
+template<typename Scalar, int... Ns>
+class BlockDiagonalMatrix
+{
+public:
+  /// @brief Number of diagonal blocks.
+  static constexpr std::size_t NumBlocks = sizeof...(Ns);
+
+  /// @brief Size of the (square) matrix.
+  static constexpr int Size = (Ns + ...);
+
+  /// @brief Dense matrix type.
+  using DenseType = Eigen::Matrix<Scalar, Size, Size>;
+
+  /// @brief Block no Idx.
+  template<std::size_t Idx>
+  auto & block()
+  {
+    return std::get<Idx>(m_blocks);
+  }
+
+  /// @brief Const block no Idx.
+  template<std::size_t Idx>
+  const auto & block() const
+  {
+    return std::get<Idx>(m_blocks);
+  }
+
+  /// @brief Convert to dense matrix.
+  DenseType toDense() const
+  {
+    DenseType ret;
+    smooth::utils::static_for<NumBlocks>([&](auto i) {
+      static constexpr int B = get<i>(Starts);
+      static constexpr int N = get<i>(Sizes);
+      if constexpr (B > 0) { ret.template block<N, B>(B, 0).setZero(); }
+      ret.template block<N, N>(B, B) = block<i>();
+      if constexpr (B + N < Size) { ret.template block<N, Size - B - N>(B, B + N).setZero(); }
+    });
+    return ret;
+  }
+
+  /// @brief Blockwise product with a dense matrix or vector.
+  template<typename Derived>
+  Eigen::Matrix<Scalar, Size, Derived::ColsAtCompileTime> operator*(const Eigen::MatrixBase<Derived> & x) const
+  {
+    Eigen::Matrix<Scalar, Size, Derived::ColsAtCompileTime> ret(Size, x.cols());
+    smooth::utils::static_for<NumBlocks>([&](auto i) {
+      static constexpr int B = get<i>(Starts);
+      static constexpr int N = get<i>(Sizes);
+      ret.template middleRows<N>(B).noalias() = block<i>() * x.template middleRows<N>(B);
+    });
+    return ret;
+  }
+
+  /// @brief Blockwise transpose.
+  BlockDiagonalMatrix transpose() const
+  {
+    BlockDiagonalMatrix ret;
+    smooth::utils::static_for<NumBlocks>([&](auto i) { ret.template block<i>() = block<i>().transpose(); });
+    return ret;
+  }
+
+  /// @brief Blockwise inverse.
+  BlockDiagonalMatrix inverse() const
+  {
+    BlockDiagonalMatrix ret;
+    smooth::utils::static_for<NumBlocks>([&](auto i) { ret.template block<i>() = block<i>().inverse(); });
+    return ret;
+  }
+
+private:
+  static constexpr std::array<int, NumBlocks> Sizes{Ns...};
+  static constexpr auto Starts = smooth::utils::array_psum(Sizes);
+
+  std::tuple<Eigen::Matrix<Scalar, Ns, Ns>...> m_blocks;
+};
+
 template<typename... GsImpl>
 struct BundleImpl
 {
@@ -49,30 +147,61 @@ struct BundleImpl
 
   SMOOTH_DEFINE_REFS;
 
+  /// @brief Block-diagonal tangent map type, see Ad_blockdiag().
+  using TangentMapBlockDiag = BlockDiagonalMatrix<Scalar, GsImpl::Dof...>;
+
+  // Consecutive Euclidean parts are merged into runs that are processed with single vector
+  // operations. Run r covers parts [RunParts[r], RunParts[r + 1]) and is either a single
+  // non-Euclidean part or one or more consecutive Euclidean parts.
+
+  static constexpr std::array<bool, sizeof...(GsImpl)> IsEuclidean{detail::is_tn_impl<GsImpl>::value...};
+
+  static constexpr std::size_t NumRuns = [] {
+    std::size_t ret = 0;
+    for (auto i = 0u; i < BundleSize; ++i) {
+      if (i == 0 || !IsEuclidean[i] || !IsEuclidean[i - 1]) { ++ret; }
+    }
+    return ret;
+  }();
+
+  static constexpr std::array<std::size_t, NumRuns + 1> RunParts = [] {
+    std::array<std::size_t, NumRuns + 1> ret{};
+    std::size_t r = 0;
+    for (auto i = 0u; i < BundleSize; ++i) {
+      if (i == 0 || !IsEuclidean[i] || !IsEuclidean[i - 1]) { ret[r++] = i; }
+    }
+    ret[NumRuns] = BundleSize;
+    return ret;
+  }();
+
   // clang-format off
 
   static void setIdentity(GRefOut g_out)
   {
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
-      PartImpl<i>::setIdentity(
-        g_out.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum))
-      );  //NOLINT
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int, int>() {
+      if constexpr (IsEuclidean[i]) {
+        g_out.template segment<Rn>(Rb).setZero();
+      } else {
+        PartImpl<i>::setIdentity(g_out.template segment<Rn>(Rb));
+      }
     });
   }
 
   static void setRandom(GRefOut g_out)
   {
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
-      PartImpl<i>::setRandom(
-        g_out.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum))
-      ); //NOLINT
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int, int>() {
+      if constexpr (IsEuclidean[i]) {
+        g_out.template segment<Rn>(Rb).setRandom();
+      } else {
+        PartImpl<i>::setRandom(g_out.template segment<Rn>(Rb));
+      }
     });
   }
 
   static void matrix(GRefIn g_in, MRefOut m_out)
   {
-    m_out.setZero();
     smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+      zero_offdiag<get<i>(DimsPsum), get<i>(Dims)>(m_out);
       PartImpl<i>::matrix(
         g_in.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)),
         m_out.template block<get<i>(Dims), get<i>(Dims)>(get<i>(DimsPsum), get<i>(DimsPsum))
@@ -82,64 +211,66 @@ struct BundleImpl
 
   static void composition(GRefIn g_in1, GRefIn g_in2, GRefOut g_out)
   {
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
-      PartImpl<i>::composition(
-        g_in1.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)),
-        g_in2.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)),
-        g_out.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum))
-      ); //NOLINT
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int, int>() {
+      if constexpr (IsEuclidean[i]) {
+        g_out.template segment<Rn>(Rb) = g_in1.template segment<Rn>(Rb) + g_in2.template segment<Rn>(Rb);
+      } else {
+        PartImpl<i>::composition(
+          g_in1.template segment<Rn>(Rb), g_in2.template segment<Rn>(Rb), g_out.template segment<Rn>(Rb)
+        ); //NOLINT
+      }
     });
   }
 
   static void inverse(GRefIn g_in, GRefOut g_out)
   {
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
-      PartImpl<i>::inverse(
-        g_in.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)),
-        g_out.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum))
-      ); //NOLINT
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int, int>() {
+      if constexpr (IsEuclidean[i]) {
+        g_out.template segment<Rn>(Rb) = -g_in.template segment<Rn>(Rb);
+      } else {
+        PartImpl<i>::inverse(g_in.template segment<Rn>(Rb), g_out.template segment<Rn>(Rb));
+      }
     });
   }
 
   static void log(GRefIn g_in, TRefOut a_out)
   {
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
-      PartImpl<i>::log(
-        g_in.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)),
-        a_out.template segment<get<i>(Dofs)>(get<i>(DofsPsum))
-      ); //NOLINT
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int Db, int Dn>() {
+      if constexpr (IsEuclidean[i]) {
+        a_out.template segment<Dn>(Db) = g_in.template segment<Rn>(Rb);
+      } else {
+        PartImpl<i>::log(g_in.template segment<Rn>(Rb), a_out.template segment<Dn>(Db));
+      }
     });
   }
 
   static void Ad(GRefIn g_in, TMapRefOut A_out)
   {
-    A_out.setZero();
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int Db, int Dn>() {
+      zero_offdiag<Db, Dn>(A_out);
       if constexpr (!PartImpl<i>::IsCommutative) {
-        PartImpl<i>::Ad(
-          g_in.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)),
-          A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum))
-        ); //NOLINT
+        PartImpl<i>::Ad(g_in.template segment<Rn>(Rb), A_out.template block<Dn, Dn>(Db, Db));
       } else {
-        A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum)).setIdentity();
+        A_out.template block<Dn, Dn>(Db, Db).setIdentity();
       }
     });
   }
 
   static void exp(TRefIn a_in, GRefOut g_out)
   {
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
-      PartImpl<i>::exp(
-        a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)),
-        g_out.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum))
-      ); //NOLINT
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int Db, int Dn>() {
+      if constexpr (IsEuclidean[i]) {
+        g_out.template segment<Rn>(Rb) = a_in.template segment<Dn>(Db);
+      } else {
+        PartImpl<i>::exp(a_in.template segment<Dn>(Db), g_out.template segment<Rn>(Rb));
+      }
     });
   }
 
   static void hat(TRefIn a_in, MRefOut A_out)
   {
-    A_out.setZero();
     smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+      zero_offdiag<get<i>(DimsPsum), get<i>(Dims)>(A_out);
       PartImpl<i>::hat(
         a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)),
         A_out.template block<get<i>(Dims), get<i>(Dims)>(get<i>(DimsPsum), get<i>(DimsPsum))
@@ -158,41 +289,34 @@ struct BundleImpl
   }
 
   static void ad(TRefIn a_in, TMapRefOut A_out) {
-    A_out.setZero();
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+    for_each_run([&]<std::size_t i, int, int, int Db, int Dn>() {
+      zero_offdiag<Db, Dn>(A_out);
       if constexpr (!PartImpl<i>::IsCommutative) {
-        PartImpl<i>::ad(
-          a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)),
-          A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum))
-        ); //NOLINT
+        PartImpl<i>::ad(a_in.template segment<Dn>(Db), A_out.template block<Dn, Dn>(Db, Db));
+      } else {
+        A_out.template block<Dn, Dn>(Db, Db).setZero();
       }
     });
   }
 
   static void dr_exp(TRefIn a_in, TMapRefOut A_out) {
-    A_out.setZero();
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+    for_each_run([&]<std::size_t i, int, int, int Db, int Dn>() {
+      zero_offdiag<Db, Dn>(A_out);
       if constexpr (!PartImpl<i>::IsCommutative) {
-        PartImpl<i>::dr_exp(
-          a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)),
-          A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum))
-        ); //NOLINT
+        PartImpl<i>::dr_exp(a_in.template segment<Dn>(Db), A_out.template block<Dn, Dn>(Db, Db));
       } else {
-          A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum)).setIdentity();
+        A_out.template block<Dn, Dn>(Db, Db).setIdentity();
       }
     });
   }
 
   static void dr_expinv(TRefIn a_in, TMapRefOut A_out) {
-    A_out.setZero();
-    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+    for_each_run([&]<std::size_t i, int, int, int Db, int Dn>() {
+      zero_offdiag<Db, Dn>(A_out);
       if constexpr (!PartImpl<i>::IsCommutative) {
-        PartImpl<i>::dr_expinv(
-          a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)),
-          A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum))
-        ); //NOLINT
+        PartImpl<i>::dr_expinv(a_in.template segment<Dn>(Db), A_out.template block<Dn, Dn>(Db, Db));
       } else {
-        A_out.template block<get<i>(Dofs), get<i>(Dofs)>(get<i>(DofsPsum), get<i>(DofsPsum)).setIdentity();
+        A_out.template block<Dn, Dn>(Db, Db).setIdentity();
       }
     });
   }
@@ -227,7 +351,112 @@ struct BundleImpl
     });
   }
 
+  static void exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out) {
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int Db, int Dn>() {
+      zero_offdiag<Db, Dn>(A_out);
+      if constexpr (!PartImpl<i>::IsCommutative) {
+        PartImpl<i>::exp_dr_exp(
+          a_in.template segment<Dn>(Db), g_out.template segment<Rn>(Rb), A_out.template block<Dn, Dn>(Db, Db)
+        ); //NOLINT
+      } else {
+        if constexpr (IsEuclidean[i]) {
+          g_out.template segment<Rn>(Rb) = a_in.template segment<Dn>(Db);
+        } else {
+          PartImpl<i>::exp(a_in.template segment<Dn>(Db), g_out.template segment<Rn>(Rb));
+        }
+        A_out.template block<Dn, Dn>(Db, Db).setIdentity();
+      }
+    });
+  }
+
+  static void log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out) {
+    for_each_run([&]<std::size_t i, int Rb, int Rn, int Db, int Dn>() {
+      zero_offdiag<Db, Dn>(A_out);
+      if constexpr (!PartImpl<i>::IsCommutative) {
+        PartImpl<i>::log_dr_expinv(
+          g_in.template segment<Rn>(Rb), a_out.template segment<Dn>(Db), A_out.template block<Dn, Dn>(Db, Db)
+        ); //NOLINT
+      } else {
+        if constexpr (IsEuclidean[i]) {
+          a_out.template segment<Dn>(Db) = g_in.template segment<Rn>(Rb);
+        } else {
+          PartImpl<i>::log(g_in.template segment<Rn>(Rb), a_out.template segment<Dn>(Db));
+        }
+        A_out.template block<Dn, Dn>(Db, Db).setIdentity();
+      }
+    });
+  }
+
   // clang-format on
+
+  /// @brief Diagonal blocks of Ad.
+  static void Ad_blockdiag(GRefIn g_in, TangentMapBlockDiag & A_out)
+  {
+    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+      if constexpr (!PartImpl<i>::IsCommutative) {
+        PartImpl<i>::Ad(g_in.template segment<get<i>(RepSizes)>(get<i>(RepSizesPsum)), A_out.template block<i>());
+      } else {
+        A_out.template block<i>().setIdentity();
+      }
+    });
+  }
+
+  /// @brief Diagonal blocks of dr_exp.
+  static void dr_exp_blockdiag(TRefIn a_in, TangentMapBlockDiag & A_out)
+  {
+    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+      if constexpr (!PartImpl<i>::IsCommutative) {
+        PartImpl<i>::dr_exp(a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)), A_out.template block<i>());
+      } else {
+        A_out.template block<i>().setIdentity();
+      }
+    });
+  }
+
+  /// @brief Diagonal blocks of dr_expinv.
+  static void dr_expinv_blockdiag(TRefIn a_in, TangentMapBlockDiag & A_out)
+  {
+    smooth::utils::static_for<sizeof...(GsImpl)>([&](auto i) {
+      if constexpr (!PartImpl<i>::IsCommutative) {
+        PartImpl<i>::dr_expinv(a_in.template segment<get<i>(Dofs)>(get<i>(DofsPsum)), A_out.template block<i>());
+      } else {
+        A_out.template block<i>().setIdentity();
+      }
+    });
+  }
+
+private:
+  /**
+   * @brief Call f.template operator()<i, Rb, Rn, Db, Dn>() for each run.
+   *
+   * i is the first part of the run, [Rb, Rb + Rn) the representation range of the run, and
+   * [Db, Db + Dn) the tangent range of the run.
+   */
+  template<typename F>
+  static void for_each_run(F && f)
+  {
+    smooth::utils::static_for<NumRuns>([&](auto r) {
+      static constexpr std::size_t i0 = get<r>(RunParts);
+      static constexpr std::size_t i1 = get<r + 1>(RunParts);
+      f.template operator()<
+        i0,
+        RepSizesPsum[i0],
+        RepSizesPsum[i1] - RepSizesPsum[i0],
+        DofsPsum[i0],
+        DofsPsum[i1] - DofsPsum[i0]>();
+    });
+  }
+
+  /**
+   * @brief Zero rows [B, B + N) of a square matrix except for the diagonal block.
+   */
+  template<int B, int N, typename Derived>
+  static void zero_offdiag(Eigen::MatrixBase<Derived> & m)
+  {
+    static constexpr int S = Derived::ColsAtCompileTime;
+    if constexpr (B > 0) { m.template block<N, B>(B, 0).setZero(); }
+    if constexpr (B + N < S) { m.template block<N, S - B - N>(B, B + N).setZero(); }
+  }
 };
 
 SMOOTH_END_NAMESPACE
@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+#include <Eigen/Core>
+
+#include "common.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+namespace detail {
+
+/**
+ * @brief Congruence transform A P A' for block-arrow matrices A.
+ *
+ * A consists of (K + 1) x (K + 1) blocks of size 3 x 3 and is zero except for the diagonal blocks
+ * and the last block column:
+ *
+ * [ D0  0  ...  C0 ]
+ * [  0 D1  ...  C1 ]
+ * [       ...      ]
+ * [  0  0  ...  DK ]
+ *
+ * This is the structure of Ad and dr_exp of SE3 and SE_K_3. Only the non-zero blocks of A are
+ * read. P_out may alias P_in.
+ */
+template<int K, typename DerivedA, typename DerivedP, typename DerivedO>
+void block_arrow_congruence(
+  const Eigen::MatrixBase<DerivedA> & A, const Eigen::MatrixBase<DerivedP> & P_in, Eigen::MatrixBase<DerivedO> & P_out)
+{
+  using Scalar = typename DerivedA::Scalar;
+
+  static constexpr int N = 3 * (K + 1);
+
+  // AP = A * P
+  Eigen::Matrix<Scalar, N, N> AP;
+  for (auto i = 0; i < K; ++i) {
+    AP.template middleRows<3>(3 * i).noalias() =
+      A.template block<3, 3>(3 * i, 3 * i) * P_in.template middleRows<3>(3 * i)
+      + A.template block<3, 3>(3 * i, 3 * K) * P_in.template middleRows<3>(3 * K);
+  }
+  AP.template middleRows<3>(3 * K).noalias() =
+    A.template block<3, 3>(3 * K, 3 * K) * P_in.template middleRows<3>(3 * K);
+
+  // P_out = AP * A'
+  for (auto j = 0; j < K; ++j) {
+    P_out.template middleCols<3>(3 * j).noalias() =
+      AP.template middleCols<3>(3 * j) * A.template block<3, 3>(3 * j, 3 * j).transpose()
+      + AP.template middleCols<3>(3 * K) * A.template block<3, 3>(3 * j, 3 * K).transpose();
+  }
+  P_out.template middleCols<3>(3 * K).noalias() =
+    AP.template middleCols<3>(3 * K) * A.template block<3, 3>(3 * K, 3 * K).transpose();
+}
+
+}  // namespace detail
+
+SMOOTH_END_NAMESPACE
@@ -3,7 +3,9 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
 #include <utility>
+#include <vector>
 
 #include "smooth/diff.hpp"
 #include "wrt_impl.hpp"
@@ -59,9 +61,9 @@ auto dr_numerical(auto && f, auto && x)
           eps_j *= abs(w[j]);
           if (eps_j == Scalar(0.)) { eps_j = eps; }
         }
-        w             = rplus<W>(w, (eps_j * Eigen::Vector<Scalar, Nx_j>::Unit(nx_j, j)).eval());
+        rplus_assign(w, (eps_j * Eigen::Vector<Scalar, Nx_j>::Unit(nx_j, j)).eval());
         J.col(I0 + j) = rminus<Result>(std::apply(f, x_nc), fval) / eps_j;
-        w             = rplus<W>(w, (-eps_j * Eigen::Vector<Scalar, Nx_j>::Unit(nx_j, j)).eval());
+        rplus_assign(w, (-eps_j * Eigen::Vector<Scalar, Nx_j>::Unit(nx_j, j)).eval());
       }
       I0 += nx_j;
     });
@@ -95,9 +97,9 @@ auto dr_numerical(auto && f, auto && x)
             if (eps0 == 0.) { eps0 = sqrteps; }
           }
 
-          w0               = rplus<W0>(w0, eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
+          rplus_assign(w0, eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
           const Result F10 = std::apply(f, x_nc);
-          w0               = rplus<W0>(w0, -eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
+          rplus_assign(w0, -eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
 
           const Eigen::Matrix<Scalar, Ny, 1> d1 = rminus(F10, fval);
 
@@ -111,12 +113,12 @@ auto dr_numerical(auto && f, auto && x)
             }
 
             // do this in order to ensure we return to same point on spaces with non-zero brackets
-            w1               = rplus<W1>(w1, eps1 * Eigen::Vector<Scalar, Nx_i1>::Unit(nx_i1, k1));
+            rplus_assign(w1, eps1 * Eigen::Vector<Scalar, Nx_i1>::Unit(nx_i1, k1));
             const Result F01 = std::apply(f, x_nc);
-            w0               = rplus<W0>(w0, eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
+            rplus_assign(w0, eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
             const Result F11 = std::apply(f, x_nc);
-            w0               = rplus<W0>(w0, -eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
-            w1               = rplus<W1>(w1, -eps1 * Eigen::Vector<Scalar, Nx_i1>::Unit(nx_i1, k1));
+            rplus_assign(w0, -eps0 * Eigen::Vector<Scalar, Nx_i0>::Unit(nx_i0, k0));
+            rplus_assign(w1, -eps1 * Eigen::Vector<Scalar, Nx_i1>::Unit(nx_i1, k1));
 
             const Eigen::Matrix<Scalar, Ny, 1> d2 = (rminus(F11, F01) - d1) / eps0 / eps1;
             for (auto j = 0u; j < ny; ++j) { H(I0 + k0, j * nx + I1 + k1) = d2(j); }
@@ -131,6 +133,141 @@ auto dr_numerical(auto && f, auto && x)
   }
 }
 
+/**
+ * @brief Add eps to tangent degree of freedom idx of a tuple of variables (in-place).
+ */
+template<typename Scalar>
+void wrt_rplus_unit_inplace(auto & x, const Eigen::Index idx, const Scalar eps)
+{
+  static constexpr auto NumArgs = std::tuple_size_v<std::decay_t<decltype(x)>>;
+
+  Eigen::Index I0 = 0;
+  utils::static_for<NumArgs>([&](auto i) {
+    auto & w                   = std::get<i>(x);
+    using W                    = std::decay_t<decltype(w)>;
+    static constexpr auto Nx_i = Dof<W>;
+    const auto nx_i            = dof<W>(w);
+    if (I0 <= idx && idx < I0 + nx_i) {
+      rplus_assign(w, (eps * Eigen::Vector<Scalar, Nx_i>::Unit(nx_i, idx - I0)).eval());
+    }
+    I0 += nx_i;
+  });
+}
+
+auto dr_hvp_numerical(auto && f, auto && x, const auto & v)
+{
+  using Wrt    = decltype(x);
+  using Result = decltype(std::apply(f, x));
+  using Scalar = ::smooth::Scalar<Result>;
+
+  static_assert(Manifold<Result>, "f(x) is not a Manifold");
+
+  const Scalar eps = std::sqrt(std::sqrt(Eigen::NumTraits<Scalar>::epsilon()));
+
+  auto x_nc   = wrt_copy_if_const(std::forward<Wrt>(x));
+  Result fval = std::apply(f, x_nc);
+
+  static constexpr auto Nx = wrt_Dof<Wrt>();
+  static constexpr auto Ny = Dof<Result>;
+
+  const auto nx = std::apply([](auto &&... args) { return (dof(args) + ...); }, x_nc);
+  const auto ny = dof<Result>(fval);
+
+  assert(v.size() == nx);
+
+  // step along v s.t. the perturbation has norm eps
+  const Scalar vnorm                 = v.norm();
+  const Scalar epsv                  = vnorm > Scalar(0) ? eps / vnorm : eps;
+  const Eigen::Vector<Scalar, Nx> dv = epsv * v;
+
+  Eigen::Matrix<Scalar, Ny, Nx> J(ny, nx);
+  Eigen::Matrix<Scalar, Nx, Ny> Hv(nx, ny);
+
+  // first pass at x + dv: store rminus(f(x + dv + e_k), f(x + dv)) in Hv
+  wrt_rplus_assign(x_nc, dv);
+  const Result F01 = std::apply(f, x_nc);
+  for (auto k = 0; k != nx; ++k) {
+    wrt_rplus_unit_inplace(x_nc, k, eps);
+    Hv.row(k) = rminus<Result>(std::apply(f, x_nc), F01).transpose();
+    wrt_rplus_unit_inplace(x_nc, k, -eps);
+  }
+  wrt_rplus_assign(x_nc, (-dv).eval());
+
+  // second pass at x
+  for (auto k = 0; k != nx; ++k) {
+    wrt_rplus_unit_inplace(x_nc, k, eps);
+    J.col(k) = rminus<Result>(std::apply(f, x_nc), fval);
+    wrt_rplus_unit_inplace(x_nc, k, -eps);
+  }
+
+  Hv -= J.transpose();
+  Hv /= eps * epsv;
+  J /= eps;
+
+  return std::make_tuple(std::move(fval), std::move(J), std::move(Hv));
+}
+
+template<std::size_t B>
+auto dr_hessian_blockdiag_numerical(auto && f, auto && x)
+{
+  using Wrt    = decltype(x);
+  using Result = decltype(std::apply(f, x));
+  using Scalar = ::smooth::Scalar<Result>;
+
+  static_assert(Manifold<Result>, "f(x) is not a Manifold");
+
+  const Scalar eps = std::sqrt(std::sqrt(Eigen::NumTraits<Scalar>::epsilon()));
+
+  auto x_nc   = wrt_copy_if_const(std::forward<Wrt>(x));
+  Result fval = std::apply(f, x_nc);
+
+  static constexpr auto Nx = wrt_Dof<Wrt>();
+  static constexpr auto Ny = Dof<Result>;
+  static constexpr auto Nb = static_cast<int>(B);
+
+  const auto nx = std::apply([](auto &&... args) { return (dof(args) + ...); }, x_nc);
+  const auto ny = dof<Result>(fval);
+
+  Eigen::Matrix<Scalar, Ny, Nx> J(ny, nx);
+  Eigen::Matrix<Scalar, Nx, Ny == -1 ? -1 : Nb * Ny> Hb(nx, Nb * ny);
+  Hb.setZero();
+
+  // values f(x + e_k) for k in current block
+  std::vector<Result> F10;
+  F10.reserve(B);
+
+  for (Eigen::Index b0 = 0; b0 < nx; b0 += Nb) {
+    const Eigen::Index nb = std::min<Eigen::Index>(Nb, nx - b0);
+
+    F10.clear();
+    for (auto k = 0; k != nb; ++k) {
+      wrt_rplus_unit_inplace(x_nc, b0 + k, eps);
+      F10.push_back(std::apply(f, x_nc));
+      wrt_rplus_unit_inplace(x_nc, b0 + k, -eps);
+      J.col(b0 + k) = rminus<Result>(F10.back(), fval);
+    }
+
+    for (auto k0 = 0; k0 != nb; ++k0) {
+      for (auto k1 = 0; k1 != nb; ++k1) {
+        // same order as in dr_numerical
+        wrt_rplus_unit_inplace(x_nc, b0 + k1, eps);
+        wrt_rplus_unit_inplace(x_nc, b0 + k0, eps);
+        const Result F11 = std::apply(f, x_nc);
+        wrt_rplus_unit_inplace(x_nc, b0 + k0, -eps);
+        wrt_rplus_unit_inplace(x_nc, b0 + k1, -eps);
+
+        const Eigen::Matrix<Scalar, Ny, 1> d2 =
+          (rminus<Result>(F11, F10[static_cast<std::size_t>(k1)]) - J.col(b0 + k0)) / (eps * eps);
+        for (auto j = 0; j < ny; ++j) { Hb(b0 + k0, j * Nb + k1) = d2(j); }
+      }
+    }
+  }
+
+  J /= eps;
+
+  return std::make_tuple(std::move(fval), std::move(J), std::move(Hb));
+}
+
 /// @brief Callable types that provide first-order derivative
 template<class F, class Wrt>
 concept diffable_order1 = requires(F && f, Wrt && wrt) {
@@ -252,6 +389,140 @@ auto dr(auto && f, auto && x, std::index_sequence<Idx...> idx)
   return dr<K, Type::Default>(std::forward<decltype(f)>(f), std::forward<decltype(x)>(x), idx);
 }
 
+template<Type D>
+auto dr_hvp(auto && f, auto && x, const auto & v)
+{
+  using F   = decltype(f);
+  using Wrt = decltype(x);
+
+  if constexpr (D == Type::Numerical) {
+    // Numerical
+
+    return detail::dr_hvp_numerical(std::forward<F>(f), std::forward<Wrt>(x), v);
+
+  } else if constexpr (D == Type::Autodiff) {
+    // Autodiff
+
+#ifdef SMOOTH_DIFF_AUTODIFF
+    return dr_autodiff_hvp(std::forward<F>(f), std::forward<Wrt>(x), v);
+#else
+    static_assert(D != Type::Autodiff, "compat/autodiff.hpp must be included before diff.hpp");
+#endif
+
+  } else if constexpr (D == Type::Analytic) {
+    // Analytic
+
+    auto [fval, J, H] = dr<2, Type::Analytic>(std::forward<F>(f), std::forward<Wrt>(x));
+
+    using Scalar = ::smooth::Scalar<std::decay_t<decltype(fval)>>;
+
+    static constexpr auto Nx = wrt_Dof<Wrt>();
+    static constexpr auto Ny = Dof<std::decay_t<decltype(fval)>>;
+
+    const auto nx = J.cols();
+    const auto ny = J.rows();
+
+    Eigen::Matrix<Scalar, Nx, Ny> Hv(nx, ny);
+    for (auto i = 0; i < ny; ++i) { Hv.col(i) = H.middleCols(i * nx, nx) * v; }
+
+    return std::make_tuple(std::move(fval), std::move(J), std::move(Hv));
+
+  } else if constexpr (D == Type::Default) {
+    // Default
+
+    if constexpr (detail::diffable_order2<F, Wrt>) {
+      return dr_hvp<Type::Analytic>(std::forward<F>(f), std::forward<Wrt>(x), v);
+    } else {
+      static constexpr Type DefaultType =
+#ifdef SMOOTH_DIFF_AUTODIFF
+        Type::Autodiff;
+#else
+        Type::Numerical;
+#endif
+      return dr_hvp<DefaultType>(std::forward<F>(f), std::forward<Wrt>(x), v);
+    }
+  } else {
+    static_assert(D != Type::Ceres, "Hessian-vector products not supported with Ceres");
+  }
+}
+
+auto dr_hvp(auto && f, auto && x, const auto & v)
+{
+  return dr_hvp<Type::Default>(std::forward<decltype(f)>(f), std::forward<decltype(x)>(x), v);
+}
+
+template<std::size_t B, Type D>
+  requires(B >= 1)
+auto dr_hessian_blockdiag(auto && f, auto && x)
+{
+  using F   = decltype(f);
+  using Wrt = decltype(x);
+
+  if constexpr (D == Type::Numerical) {
+    // Numerical
+
+    return detail::dr_hessian_blockdiag_numerical<B>(std::forward<F>(f), std::forward<Wrt>(x));
+
+  } else if constexpr (D == Type::Autodiff) {
+    // Autodiff
+
+#ifdef SMOOTH_DIFF_AUTODIFF
+    return dr_autodiff_blockdiag<B>(std::forward<F>(f), std::forward<Wrt>(x));
+#else
+    static_assert(D != Type::Autodiff, "compat/autodiff.hpp must be included before diff.hpp");
+#endif
+
+  } else if constexpr (D == Type::Analytic) {
+    // Analytic
+
+    auto [fval, J, H] = dr<2, Type::Analytic>(std::forward<F>(f), std::forward<Wrt>(x));
+
+    using Scalar = ::smooth::Scalar<std::decay_t<decltype(fval)>>;
+
+    static constexpr auto Nx = wrt_Dof<Wrt>();
+    static constexpr auto Ny = Dof<std::decay_t<decltype(fval)>>;
+    static constexpr auto Nb = static_cast<int>(B);
+
+    const auto nx = J.cols();
+    const auto ny = J.rows();
+
+    Eigen::Matrix<Scalar, Nx, Ny == -1 ? -1 : Nb * Ny> Hb(nx, Nb * ny);
+    Hb.setZero();
+    for (auto i = 0; i < ny; ++i) {
+      for (auto j = 0; j < nx; ++j) {
+        const auto b0 = Nb * (j / Nb);
+        for (auto k = 0; k < Nb && b0 + k < nx; ++k) { Hb(j, i * Nb + k) = H(j, i * nx + b0 + k); }
+      }
+    }
+
+    return std::make_tuple(std::move(fval), std::move(J), std::move(Hb));
+
+  } else if constexpr (D == Type::Default) {
+    // Default
+
+    if constexpr (detail::diffable_order2<F, Wrt>) {
+      return dr_hessian_blockdiag<B, Type::Analytic>(std::forward<F>(f), std::forward<Wrt>(x));
+    } else {
+      static constexpr Type DefaultType =
+#ifdef SMOOTH_DIFF_AUTODIFF
+        Type::Autodiff;
+#else
+        Type::Numerical;
+#endif
+      return dr_hessian_blockdiag<B, DefaultType>(std::forward<F>(f), std::forward<Wrt>(x));
+    }
+  } else {
+    static_assert(D != Type::Ceres, "Block-diagonal Hessians not supported with Ceres");
+  }
+}
+
+template<std::size_t B>
+  requires(B >= 1)
+auto dr_hessian_blockdiag(auto && f, auto && x)
+{
+  return dr_hessian_blockdiag<B, Type::Default>(std::forward<decltype(f)>(f), std::forward<decltype(x)>(x));
+}
+
 }  // namespace diff
 
 SMOOTH_END_NAMESPACE
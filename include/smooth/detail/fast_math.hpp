@@ -0,0 +1,185 @@
+// Copyright (C) 2021-2022 Petter Nilsson. MIT License.
+
+#pragma once
+
+/**
+ * @file
+ * @brief Branch-free minimax polynomial approximations for SO(3) exp/log and Taylor tails.
+ *
+ * Enabled by defining SMOOTH_FAST_MATH before including smooth headers. When enabled, SO3 exp,
+ * log, dr_exp, dr_expinv and the Taylor tails in trig.hpp are evaluated with the polynomials below
+ * for float and double scalars; other scalar types (e.g. autodiff types) are unaffected.
+ *
+ * All functions are polynomials in a squared argument evaluated with Horner's scheme. They contain
+ * no branches, square roots or transcendental calls, and work for scalars as well as Eigen arrays.
+ *
+ * Approximations are valid on bounded ranges only. With x the rotation angle the domain is
+ * 0 <= x^2 <= pi^2 (see max_x2), and the logarithm requires a unit quaternion with qw >= 0. Callers
+ * check the domain and fall back to the exact implementation for arguments outside of it, so e.g.
+ * exp() and dr_expinv() of tangents with norm above pi remain exact.
+ *
+ * Maximum relative error on the domain (absolute error for cos_half), measured on a dense grid in
+ * the respective floating point arithmetic (including rounding) against a 40-digit reference:
+ *
+ * | function  | approximates                           | domain      | float  | double  |
+ * | --------- | -------------------------------------- | ----------- | ------ | ------- |
+ * | cos_half  | cos(x / 2)                             | x^2 <= pi^2 | 1.2e-7 | 1.8e-16 |
+ * | sinc_half | sin(x / 2) / x                         | x^2 <= pi^2 | 1.1e-7 | 3.2e-16 |
+ * | cos_2     | (cos x - 1) / x^2                      | x^2 <= pi^2 | 1.6e-7 | 4.4e-16 |
+ * | sin_3     | (sin x - x) / x^3                      | x^2 <= pi^2 | 1.2e-7 | 2.8e-16 |
+ * | cos_4     | (cos x - 1 + x^2 / 2) / x^4            | x^2 <= pi^2 | 1.5e-7 | 4.1e-16 |
+ * | sin_5     | (sin x - x + x^3 / 6) / x^5            | x^2 <= pi^2 | 1.3e-7 | 1.7e-16 |
+ * | cos_6     | (cos x - 1 + x^2 / 2 - x^4 / 24) / x^6 | x^2 <= pi^2 | 1.0e-7 | 1.8e-16 |
+ * | dexpinv   | 1 / x^2 - (1 + cos x) / (2 x sin x)    | x^2 <= pi^2 | 7.6e-8 | 2.7e-16 |
+ * | atan_sqrt | atan(sqrt(t)) / sqrt(t)                | 0 <= t <= 1 | 1.0e-7 | 3.5e-16 |
+ */
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "common.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+namespace detail {
+
+/// @brief True if the SMOOTH_FAST_MATH approximations are used for scalar type S.
+template<typename S>
+inline constexpr bool use_fast_math =
+#ifdef SMOOTH_FAST_MATH
+  std::is_same_v<S, float> || std::is_same_v<S, double>;
+#else
+  false;
+#endif
+
+namespace fast {
+
+/// @brief Largest squared argument for which the approximations are valid (pi^2).
+template<typename S>
+inline constexpr S max_x2 = static_cast<S>(9.8696044010893586188);
+
+/// @brief Minimax coefficients in ascending order, one set per precision.
+template<typename S>
+struct coeffs;
+
+// clang-format off
+template<>
+struct coeffs<float>
+{
+  static constexpr std::array<float, 5> cos_half{
+    9.99999953e-1f, -1.24999763e-1f, 2.60397404e-3f, -2.1646413e-5f, 9.04450461e-8f};
+  static constexpr std::array<float, 5> sinc_half{
+    4.99999997e-1f, -2.08333209e-2f, 2.60407036e-4f, -1.54745459e-6f, 5.08184187e-9f};
+  static constexpr std::array<float, 6> cos_2{
+    -4.99999993e-1f, 4.16666222e-2f, -1.38884074e-3f, 2.4782018e-5f, -2.71902187e-7f, 1.76248358e-9f};
+  static constexpr std::array<float, 6> sin_3{
+    -1.66666666e-1f, 8.33333069e-3f, -1.98409719e-4f, 2.75448419e-6f, -2.4812717e-8f, 1.39040846e-10f};
+  static constexpr std::array<float, 5> cos_4{
+    4.16666645e-2f, -1.3888784e-3f, 2.47933305e-5f, -2.73263793e-7f, 1.81923055e-9f};
+  static constexpr std::array<float, 5> sin_5{
+    8.33333319e-3f, -1.9841201e-4f, 2.75518456e-6f, -2.48980426e-8f, 1.42628725e-10f};
+  static constexpr std::array<float, 5> cos_6{
+    -1.38888888e-3f, 2.48015446e-5f, -2.75539009e-7f, 2.07802e-9f, -1.03436743e-11f};
+  static constexpr std::array<float, 7> dexpinv{
+    8.33333344e-2f, 1.38887865e-3f, 3.30850144e-5f, 8.17175662e-7f, 2.35006899e-8f, 1.70998381e-10f,
+    3.54435955e-11f};
+  static constexpr std::array<float, 9> atan_sqrt{
+    9.99999985e-1f, -3.33330733e-1f, 1.99926194e-1f, -1.42036445e-1f, 1.06409344e-1f, -7.50429533e-2f,
+    4.26915293e-2f, -1.60686354e-2f, 2.84989131e-3f};
+};
+
+template<>
+struct coeffs<double>
+{
+  static constexpr std::array<double, 9> cos_half{
+    1.0, -1.2499999999999993e-1, 2.604166666666493e-3, -2.1701388888708082e-5, 9.6881200302515518e-8,
+    -2.6911441790564099e-10, 5.0968168848300457e-13, -6.9964019185239847e-16, 7.0327871995925615e-19};
+  static constexpr std::array<double, 8> sinc_half{
+    4.9999999999999994e-1, -2.0833333333332458e-2, 2.6041666666487253e-4, -1.5500992049392584e-6,
+    5.3822883635337443e-9, -1.223235882982151e-11, 1.9589654092296774e-14, -2.2493477705448194e-17};
+  static constexpr std::array<double, 10> cos_2{
+    -5.0e-1, 4.1666666666666276e-2, -1.388888888887667e-3, 2.4801587300086986e-5, -2.7557319129595004e-7,
+    2.0876753551859143e-9, -1.147066896718875e-11, 4.7784130951722161e-14, -1.5529250631219357e-16,
+    3.6843359345233787e-19};
+  static constexpr std::array<double, 10> sin_3{
+    -1.6666666666666666e-1, 8.3333333333333193e-3, -1.984126984126512e-4, 2.7557319223391928e-6,
+    -2.5052108347289216e-8, 1.6059042423009287e-10, -7.647131710176184e-13, 2.8110065429475426e-15,
+    -8.182096636068935e-18, 1.7730679862359258e-20};
+  static constexpr std::array<double, 9> cos_4{
+    4.1666666666666657e-2, -1.3888888888887859e-3, 2.4801587301315838e-5, -2.7557319196306895e-7,
+    2.0876755568131412e-9, -1.1470704538667976e-11, 4.7787771615692294e-14, -1.5549274543873679e-16,
+    3.7301017702347829e-19};
+  static constexpr std::array<double, 9> sin_5{
+    8.3333333333333332e-3, -1.9841269841269408e-4, 2.7557319223870438e-6, -2.5052108373595991e-8,
+    1.6059043226091673e-10, -7.6471459944972124e-13, 2.8111537380944111e-15, -8.1902392853835357e-18,
+    1.7917708899435319e-20};
+  static constexpr std::array<double, 9> cos_6{
+    -1.3888888888888889e-3, 2.4801587301587122e-5, -2.7557319223938349e-7, 2.0876756982971476e-9,
+    -1.1470745344489063e-11, 4.7794699589297906e-14, -1.5617942697307746e-16, 4.097637878986848e-19,
+    -8.2058711908047941e-22};
+  static constexpr std::array<double, 14> dexpinv{
+    8.3333333333333329e-2, 1.3888888888892947e-3, 3.3068783066133477e-5, 8.2671958351943062e-7,
+    2.0876747905124946e-8, 5.2842625787992946e-10, 1.3378808941364527e-11, 3.4026293266500425e-13,
+    8.2749174226708452e-15, 2.695881500469988e-16, -5.1159434883501199e-19, 6.039227396133166e-19,
+    -1.8606500579843537e-20, 6.2600825106112933e-22};
+  static constexpr std::array<double, 19> atan_sqrt{
+    9.9999999999999989e-1, -3.3333333333321036e-1, 1.9999999998481616e-1, -1.4285714211127781e-1,
+    1.1111109168755222e-1, -9.0908780979145551e-2, 7.6919773001518782e-2, -6.6641761662540322e-2,
+    5.8685419878364072e-2, -5.2051660323413358e-2, 4.5734326506207158e-2, -3.8652460246935277e-2,
+    3.01088488304668e-2, -2.0534415730306194e-2, 1.1596080187699321e-2, -5.0976157502949275e-3,
+    1.6125940387901828e-3, -3.2352930052243146e-4, 3.0728719680168834e-5};
+};
+// clang-format on
+
+/**
+ * @brief Evaluate polynomial with coefficients c (ascending order) at x.
+ *
+ * T is either S or an Eigen array with scalar type S.
+ */
+template<typename S, typename T, std::size_t N>
+T horner(const T & x, const std::array<S, N> & c)
+{
+  T ret = S(0) * x + c[N - 1];
+  for (std::size_t i = N - 1; i > 0; --i) { ret = ret * x + c[i - 1]; }
+  return ret;
+}
+
+// clang-format off
+/// @brief cos(x / 2) as a function of x^2
+template<typename S, typename T = S> T cos_half(const T & x2) { return horner<S>(x2, coeffs<S>::cos_half); }
+/// @brief sin(x / 2) / x as a function of x^2
+template<typename S, typename T = S> T sinc_half(const T & x2) { return horner<S>(x2, coeffs<S>::sinc_half); }
+/// @brief (cos x - 1) / x^2 as a function of x^2
+template<typename S, typename T = S> T cos_2(const T & x2) { return horner<S>(x2, coeffs<S>::cos_2); }
+/// @brief (sin x - x) / x^3 as a function of x^2
+template<typename S, typename T = S> T sin_3(const T & x2) { return horner<S>(x2, coeffs<S>::sin_3); }
+/// @brief (cos x - 1 + x^2 / 2) / x^4 as a function of x^2
+template<typename S, typename T = S> T cos_4(const T & x2) { return horner<S>(x2, coeffs<S>::cos_4); }
+/// @brief (sin x - x + x^3 / 6) / x^5 as a function of x^2
+template<typename S, typename T = S> T sin_5(const T & x2) { return horner<S>(x2, coeffs<S>::sin_5); }
+/// @brief (cos x - 1 + x^2 / 2 - x^4 / 24) / x^6 as a function of x^2
+template<typename S, typename T = S> T cos_6(const T & x2) { return horner<S>(x2, coeffs<S>::cos_6); }
+/// @brief 1 / x^2 - (1 + cos x) / (2 x sin x) as a function of x^2
+template<typename S, typename T = S> T dexpinv(const T & x2) { return horner<S>(x2, coeffs<S>::dexpinv); }
+/// @brief atan(sqrt(t)) / sqrt(t) for 0 <= t <= 1
+template<typename S, typename T = S> T atan_sqrt(const T & t) { return horner<S>(t, coeffs<S>::atan_sqrt); }
+// clang-format on
+
+/**
+ * @brief Quaternion log scale factor 2 atan2(|xyz|, w) / |xyz| for a unit quaternion with w >= 0.
+ *
+ * Uses atan2(n, w) = 2 atan(n / (1 + w)) for unit (w, n), so that the argument of atan is in [0, 1].
+ */
+template<typename S, typename T = S>
+T log_scale(const T & xyz2, const T & w)
+{
+  const T wp1 = w + S(1);
+  return S(4) * atan_sqrt<S>(T(xyz2 / (wp1 * wp1))) / wp1;
+}
+
+}  // namespace fast
+
+}  // namespace detail
+
+SMOOTH_END_NAMESPACE
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include <Eigen/Core>
 
 #include "../derivatives.hpp"
@@ -192,10 +194,15 @@ public:
   static Eigen::Matrix3<Scalar>
   calculate_r(Eigen::Ref<const Eigen::Vector3<Scalar>> v, Eigen::Ref<const Eigen::Vector3<Scalar>> w)
   {
-    using detail::sin_3, detail::cos_4, detail::sin_5, detail::cos_6;
-
-    const Scalar th2 = w.squaredNorm();
+    return calculate_r(v, w, detail::trig_tails<Scalar>(w.squaredNorm()));
+  }
 
+  /// @brief Calculate R with precomputed Taylor tails of |w|.
+  static Eigen::Matrix3<Scalar> calculate_r(
+    Eigen::Ref<const Eigen::Vector3<Scalar>> v,
+    Eigen::Ref<const Eigen::Vector3<Scalar>> w,
+    const detail::TrigTails<Scalar> & tails)
+  {
     Eigen::Matrix<Scalar, 3, 3> V, W;
     SO3Impl<Scalar>::hat(v, V);
     SO3Impl<Scalar>::hat(w, W);
@@ -205,13 +212,71 @@ public:
 
     // clang-format off
     return V / 6 +
-      + sin_3(th2) * (-WV + Scalar(0.5) * vdw * W)
-      + cos_4(th2) * (VW + W * WV - Scalar(2) * WV - Scalar(0.5) * vdw * WW + Scalar(2) * vdw * W)
-      + sin_5(th2) * (V * WW - Scalar(2) * W * WV + Scalar(2) * vdw * (WW - W))
-      + cos_6(th2) * (Scalar(2) * vdw * WW);
+      + tails.s3 * (-WV + Scalar(0.5) * vdw * W)
+      + tails.c4 * (VW + W * WV - Scalar(2) * WV - Scalar(0.5) * vdw * WW + Scalar(2) * vdw * W)
+      + tails.s5 * (V * WW - Scalar(2) * W * WV + Scalar(2) * vdw * (WW - W))
+      + tails.c6 * (Scalar(2) * vdw * WW);
     // clang-format on
   }
 
+  /**
+   * @brief Calculate R and its derivative w.r.t. [v, w] on horizontal Hessian form.
+   */
+  static std::pair<Eigen::Matrix3<Scalar>, Eigen::Matrix<Scalar, 3, 18>>
+  calculate_R_dR(Eigen::Ref<const Eigen::Vector3<Scalar>> v, Eigen::Ref<const Eigen::Vector3<Scalar>> w)
+  {
+    const Scalar th2 = w.squaredNorm();
+    const auto t     = detail::trig_tails<Scalar>(th2);
+    const auto dt    = detail::trig_tails_dx2<Scalar>(th2, t);
+
+    Eigen::Matrix<Scalar, 3, 3> V, W, E;
+    SO3Impl<Scalar>::hat(v, V);
+    SO3Impl<Scalar>::hat(w, W);
+    const Scalar vdw = v.dot(w);
+
+    const Eigen::Matrix<Scalar, 3, 3> WV = W * V, VW = V * W, WW = W * W, WWV = W * WV;
+
+    // R = V / 6 + s3 * P3 + c4 * P4 + s5 * P5 + c6 * P6
+    const Eigen::Matrix3<Scalar> P3 = -WV + Scalar(0.5) * vdw * W;
+    const Eigen::Matrix3<Scalar> P4 = VW + WWV - Scalar(2) * WV - Scalar(0.5) * vdw * WW + Scalar(2) * vdw * W;
+    const Eigen::Matrix3<Scalar> P5 = V * WW - Scalar(2) * WWV + Scalar(2) * vdw * (WW - W);
+    const Eigen::Matrix3<Scalar> P6 = Scalar(2) * vdw * WW;
+
+    const Eigen::Matrix3<Scalar> R = V / 6 + t.s3 * P3 + t.c4 * P4 + t.s5 * P5 + t.c6 * P6;
+
+    Eigen::Matrix<Scalar, 3, 18> dR;
+    for (auto l = 0u; l < 3; ++l) {
+      SO3Impl<Scalar>::hat(Eigen::Vector3<Scalar>::Unit(l), E);
+
+      // derivative w.r.t. v(l)
+      // clang-format off
+      const Eigen::Matrix3<Scalar> Dv = E / 6
+        + t.s3 * (-W * E + Scalar(0.5) * w(l) * W)
+        + t.c4 * (E * W + WW * E - Scalar(2) * W * E - Scalar(0.5) * w(l) * WW + Scalar(2) * w(l) * W)
+        + t.s5 * (E * WW - Scalar(2) * WW * E + Scalar(2) * w(l) * (WW - W))
+        + t.c6 * (Scalar(2) * w(l) * WW);
+      // clang-format on
+
+      // derivative w.r.t. w(l)
+      const Eigen::Matrix3<Scalar> EW = E * W + W * E;
+      // clang-format off
+      const Eigen::Matrix3<Scalar> Dw = Scalar(2) * w(l) * (dt.s3 * P3 + dt.c4 * P4 + dt.s5 * P5 + dt.c6 * P6)
+        + t.s3 * (-E * V + Scalar(0.5) * v(l) * W + Scalar(0.5) * vdw * E)
+        + t.c4 * (V * E + EW * V - Scalar(2) * E * V - Scalar(0.5) * v(l) * WW - Scalar(0.5) * vdw * EW
+                  + Scalar(2) * v(l) * W + Scalar(2) * vdw * E)
+        + t.s5 * (V * EW - Scalar(2) * EW * V + Scalar(2) * v(l) * (WW - W) + Scalar(2) * vdw * (EW - E))
+        + t.c6 * (Scalar(2) * v(l) * WW + Scalar(2) * vdw * EW);
+      // clang-format on
+
+      for (auto i = 0u; i < 3; ++i) {
+        dR.col(6 * i + l)     = Dv.row(i).transpose();
+        dR.col(6 * i + 3 + l) = Dw.row(i).transpose();
+      }
+    }
+
+    return {R, dR};
+  }
+
   static void dr_exp(TRefIn a_in, TMapRefOut A_out)
   {
     Eigen::Ref<const Eigen::Vector3<Scalar>> b = a_in.template segment<3>(0);
@@ -266,6 +331,269 @@ public:
 
     A_out.template block<3, 3>(7, 7) = S1inv;
   }
+
+  /**
+   * @brief Congruence A P A' for matrices with the block structure of Ad and dr_exp.
+   *
+   * With blocks (b, q, s, w) of sizes (3, 3, 1, 3) only the blocks bb, bw, qb, qq, qs, qw, ss, ww
+   * of A are non-zero and read. P_out may alias P_in.
+   */
+  static void congruence(TMapRefIn A, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    // AP = A * P
+    Eigen::Matrix<Scalar, 10, 10> AP;
+    AP.template middleRows<3>(0).noalias() = A.template block<3, 3>(0, 0) * P_in.template middleRows<3>(0)
+                                           + A.template block<3, 3>(0, 7) * P_in.template middleRows<3>(7);
+    AP.template middleRows<3>(3).noalias() = A.template block<3, 3>(3, 0) * P_in.template middleRows<3>(0)
+                                           + A.template block<3, 3>(3, 3) * P_in.template middleRows<3>(3)
+                                           + A.template block<3, 1>(3, 6) * P_in.row(6)
+                                           + A.template block<3, 3>(3, 7) * P_in.template middleRows<3>(7);
+    AP.row(6)                              = A(6, 6) * P_in.row(6);
+    AP.template middleRows<3>(7).noalias() = A.template block<3, 3>(7, 7) * P_in.template middleRows<3>(7);
+
+    // P_out = AP * A'
+    P_out.template middleCols<3>(0).noalias() = AP.template middleCols<3>(0) * A.template block<3, 3>(0, 0).transpose()
+                                              + AP.template middleCols<3>(7) * A.template block<3, 3>(0, 7).transpose();
+    P_out.template middleCols<3>(3).noalias() = AP.template middleCols<3>(0) * A.template block<3, 3>(3, 0).transpose()
+                                              + AP.template middleCols<3>(3) * A.template block<3, 3>(3, 3).transpose()
+                                              + AP.col(6) * A.template block<3, 1>(3, 6).transpose()
+                                              + AP.template middleCols<3>(7) * A.template block<3, 3>(3, 7).transpose();
+    P_out.col(6)                              = A(6, 6) * AP.col(6);
+    P_out.template middleCols<3>(7).noalias() = AP.template middleCols<3>(7) * A.template block<3, 3>(7, 7).transpose();
+  }
+
+  /**
+   * @brief Covariance transport Ad P Ad' that skips the zero blocks of Ad.
+   */
+  static void Ad_cov(GRefIn g_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, 10, 10> A;
+    Ad(g_in, A);
+    congruence(A, P_in, P_out);
+  }
+
+  /**
+   * @brief Covariance transport dr_exp P dr_exp' that skips the zero blocks of dr_exp.
+   */
+  static void dr_exp_cov(TRefIn a_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, 10, 10> A;
+    dr_exp(a_in, A);
+    congruence(A, P_in, P_out);
+  }
+
+  static void exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out)
+  {
+    Eigen::Ref<const Eigen::Vector3<Scalar>> b = a_in.template segment<3>(0);
+    Eigen::Ref<const Eigen::Vector3<Scalar>> q = a_in.template segment<3>(3);
+    const Scalar s                             = a_in(6);
+    Eigen::Ref<const Eigen::Vector3<Scalar>> w = a_in.template segment<3>(7);
+
+    A_out.setZero();
+
+    // rotation part and S1(-w) in one go
+    const auto tails = SO3Impl<Scalar>::exp_dr_exp(w, g_out.template tail<4>(), A_out.template block<3, 3>(7, 7));
+
+    const Eigen::Matrix3<Scalar> I = Eigen::Matrix3<Scalar>::Identity();
+    Eigen::Matrix3<Scalar> W;
+    SO3Impl<Scalar>::hat(w, W);
+    const Eigen::Matrix3<Scalar> WW = W * W;
+
+    const Eigen::Matrix3<Scalar> S1  = I - tails.c2 * W - tails.s3 * WW;
+    const Eigen::Matrix3<Scalar> S2  = I / Scalar(2) - tails.s3 * W + tails.c4 * WW;
+    const Eigen::Matrix3<Scalar> S1m = A_out.template block<3, 3>(7, 7);
+    const Eigen::Matrix3<Scalar> S2m = I / Scalar(2) + tails.s3 * W + tails.c4 * WW;
+
+    g_out.template segment<3>(0).noalias() = S1 * b;
+    g_out.template segment<3>(3).noalias() = S1 * q + S2 * b * s;
+    g_out(6)                               = s;
+
+    const Eigen::Matrix3<Scalar> Qb = SE3Impl<Scalar>::calculate_q(-b, -w, tails);
+    const Eigen::Matrix3<Scalar> Qq = SE3Impl<Scalar>::calculate_q(-q, -w, tails);
+    const Eigen::Matrix3<Scalar> R  = calculate_r(-b, -w, tails);
+
+    A_out.template block<3, 3>(0, 0) = S1m;
+    A_out.template block<3, 3>(0, 7) = Qb;
+
+    A_out.template block<3, 3>(3, 0)           = s * (S1m - S2m);
+    A_out.template block<3, 3>(3, 3)           = S1m;
+    A_out.template block<3, 1>(3, 6).noalias() = -S2m * b;
+    A_out.template block<3, 3>(3, 7)           = s * R + Qq;
+
+    A_out(6, 6) = Scalar(1);
+  }
+
+  static void log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out)
+  {
+    A_out.setZero();
+
+    // rotation part and S1inv(-w) in one go
+    const auto tails = SO3Impl<Scalar>::log_dr_expinv(
+      g_in.template tail<4>(), a_out.template segment<3>(7), A_out.template block<3, 3>(7, 7));
+
+    Eigen::Ref<const Eigen::Vector3<Scalar>> w = a_out.template segment<3>(7);
+
+    const Eigen::Matrix3<Scalar> I = Eigen::Matrix3<Scalar>::Identity();
+    Eigen::Matrix3<Scalar> W;
+    SO3Impl<Scalar>::hat(w, W);
+    const Eigen::Matrix3<Scalar> WW = W * W;
+
+    const Eigen::Matrix3<Scalar> S1minv = A_out.template block<3, 3>(7, 7);
+    const Eigen::Matrix3<Scalar> S1inv  = S1minv - W;
+    const Eigen::Matrix3<Scalar> S2     = I / Scalar(2) - tails.s3 * W + tails.c4 * WW;
+    const Eigen::Matrix3<Scalar> S2m    = I / Scalar(2) + tails.s3 * W + tails.c4 * WW;
+
+    a_out.template segment<3>(0).noalias() = S1inv * g_in.template segment<3>(0);
+    a_out.template segment<3>(3).noalias() =
+      S1inv * (g_in.template segment<3>(3) - S2 * a_out.template segment<3>(0) * g_in(6));
+    a_out(6) = g_in(6);
+
+    Eigen::Ref<const Eigen::Vector3<Scalar>> b = a_out.template segment<3>(0);
+    Eigen::Ref<const Eigen::Vector3<Scalar>> q = a_out.template segment<3>(3);
+    const Scalar s                             = a_out(6);
+
+    const Eigen::Matrix3<Scalar> Qb = SE3Impl<Scalar>::calculate_q(-b, -w, tails);
+    const Eigen::Matrix3<Scalar> Qq = SE3Impl<Scalar>::calculate_q(-q, -w, tails);
+    const Eigen::Matrix3<Scalar> R  = calculate_r(-b, -w, tails);
+
+    A_out.template block<3, 3>(0, 0)           = S1minv;
+    A_out.template block<3, 3>(0, 7).noalias() = -S1minv * Qb * S1minv;
+
+    A_out.template block<3, 3>(3, 0).noalias() = -s * (I - S1minv * S2m) * S1minv;
+    A_out.template block<3, 3>(3, 3).noalias() = S1minv;
+    A_out.template block<3, 1>(3, 6).noalias() = S1minv * S2m * b;
+    A_out.template block<3, 3>(3, 7).noalias() = S1minv * (-s * R - Qq + s * (I - S2m * S1minv) * Qb) * S1minv;
+
+    A_out(6, 6) = Scalar(1);
+  }
+
+  /**
+   * @brief Fused between-residual rminus(g1^-1 * g2, z) and its jacobians w.r.t. g1 and g2.
+   */
+  static void between_rminus(
+    GRefIn g_in1, GRefIn g_in2, GRefIn z_in, TRefOut a_out, TMapRefOut J1_out, TMapRefOut J2_out)
+  {
+    Eigen::Map<const Eigen::Quaternion<Scalar>> q1(g_in1.data() + 7);
+    Eigen::Map<const Eigen::Quaternion<Scalar>> q2(g_in2.data() + 7);
+    Eigen::Map<const Eigen::Quaternion<Scalar>> qz(z_in.data() + 7);
+
+    const Eigen::Matrix3<Scalar> R1T = q1.toRotationMatrix().transpose();
+    const Eigen::Matrix3<Scalar> RzT = qz.toRotationMatrix().transpose();
+
+    // d = g1^-1 * g2
+    const Eigen::Quaternion<Scalar> qd = q1.conjugate() * q2;
+    const Scalar td                    = g_in2(6) - g_in1(6);
+    const Eigen::Vector3<Scalar> vd    = R1T * (g_in2.template segment<3>(0) - g_in1.template segment<3>(0));
+    const Eigen::Vector3<Scalar> pd =
+      R1T * (g_in2.template segment<3>(3) - g_in1.template segment<3>(3) - g_in1.template segment<3>(0) * td);
+
+    // e = z^-1 * d
+    Eigen::Matrix<Scalar, 11, 1> e;
+    e.template segment<3>(0).noalias() = RzT * (vd - z_in.template segment<3>(0));
+    e.template segment<3>(3).noalias() =
+      RzT * (pd - z_in.template segment<3>(3) - z_in.template segment<3>(0) * (td - z_in(6)));
+    e(6)                 = td - z_in(6);
+    e.template tail<4>() = (qz.conjugate() * qd).coeffs();
+    if (e(10) < Scalar(0)) { e.template tail<4>() *= Scalar(-1); }
+
+    log_dr_expinv(e, a_out, J2_out);
+
+    // Ad_{d^-1} expressed in terms of d
+    const Eigen::Matrix3<Scalar> RdT = qd.toRotationMatrix().transpose();
+    Eigen::Matrix3<Scalar> Vd, Pd;
+    SO3Impl<Scalar>::hat(vd, Vd);
+    SO3Impl<Scalar>::hat(pd, Pd);
+
+    Eigen::Matrix<Scalar, 10, 10> Ad_dinv;
+    Ad_dinv.setZero();
+    Ad_dinv.template block<3, 3>(0, 0)           = RdT;
+    Ad_dinv.template block<3, 3>(0, 7).noalias() = -RdT * Vd;
+    Ad_dinv.template block<3, 3>(3, 0)           = RdT * td;
+    Ad_dinv.template block<3, 3>(3, 3)           = RdT;
+    Ad_dinv.template block<3, 1>(3, 6).noalias() = -RdT * vd;
+    Ad_dinv.template block<3, 3>(3, 7).noalias() = -RdT * Pd;
+    Ad_dinv(6, 6)                                = Scalar(1);
+    Ad_dinv.template block<3, 3>(7, 7)           = RdT;
+
+    J1_out.noalias() = -J2_out * Ad_dinv;
+  }
+
+  static void d2r_exp(TRefIn a_in, THessRefOut H_out)
+  {
+    const Eigen::Vector3<Scalar> b = a_in.template segment<3>(0);
+    const Eigen::Vector3<Scalar> q = a_in.template segment<3>(3);
+    const Scalar s                 = a_in(6);
+    const Eigen::Vector3<Scalar> w = a_in.template segment<3>(7);
+
+    // derivatives of S1(-w) w.r.t. w, and of S2(-w), Q(-b, -w), Q(-q, -w), R(-b, -w) w.r.t. their arguments
+    Eigen::Matrix<Scalar, 3, 9> dS1;
+    SO3Impl<Scalar>::d2r_exp(w, dS1);
+    const Eigen::Matrix3<Scalar> S1 = SO3Impl<Scalar>::calc_S1(-w);
+    const auto [S2, dS2]            = SO3Impl<Scalar>::calc_S2_dS2(-w);
+    const auto [R, dR]              = calculate_R_dR(-b, -w);
+
+    Eigen::Vector<Scalar, 6> bw, qw;
+    bw << -b, -w;
+    qw << -q, -w;
+    const auto [Qb, dQb] = SE3Impl<Scalar>::calculate_Q_dQ(bw);
+    const auto [Qq, dQq] = SE3Impl<Scalar>::calculate_Q_dQ(qw);
+
+    const Eigen::Matrix3<Scalar> S1mS2 = S1 - S2;
+
+    H_out.setZero();
+    for (auto i = 0u; i < 3; ++i) {
+      // block row b: [S1, 0, 0, Qb]
+      H_out.template block<3, 3>(0, 10 * i + 7) = dS1.template middleCols<3>(3 * i);
+      H_out.template block<3, 3>(7, 10 * i + 0) = -dQb.template middleCols<3>(6 * i);
+      H_out.template block<3, 3>(7, 10 * i + 7) = -dQb.template middleCols<3>(6 * i + 3);
+
+      // block row q: [s (S1 - S2), S1, -S2 b, s R + Qq]
+      H_out.template block<3, 1>(0, 10 * (3 + i) + 6) = S1mS2.row(i).transpose();
+      H_out.template block<3, 3>(0, 10 * (3 + i) + 7) =
+        s * (dS1.template middleCols<3>(3 * i) + dS2.template middleCols<3>(3 * i));
+      H_out.template block<3, 3>(3, 10 * (3 + i) + 7)           = dS1.template middleCols<3>(3 * i);
+      H_out.template block<1, 3>(6, 10 * (3 + i) + 0)           = -S2.row(i);
+      H_out.template block<1, 3>(6, 10 * (3 + i) + 7).noalias() = b.transpose() * dS2.template middleCols<3>(3 * i);
+      H_out.template block<3, 3>(7, 10 * (3 + i) + 0)           = -s * dR.template middleCols<3>(6 * i);
+      H_out.template block<3, 3>(7, 10 * (3 + i) + 3)           = -dQq.template middleCols<3>(6 * i);
+      H_out.template block<3, 1>(7, 10 * (3 + i) + 6)           = R.row(i).transpose();
+      H_out.template block<3, 3>(7, 10 * (3 + i) + 7) =
+        -s * dR.template middleCols<3>(6 * i + 3) - dQq.template middleCols<3>(6 * i + 3);
+
+      // block row w: [0, 0, 0, S1]
+      H_out.template block<3, 3>(7, 10 * (7 + i) + 7) = dS1.template middleCols<3>(3 * i);
+    }
+  }
+
+  static void d2r_expinv(TRefIn a_in, THessRefOut H_out)
+  {
+    // d (J^-1) = -J^-1 dJ J^-1 for each tangent direction
+    Eigen::Matrix<Scalar, 10, 100> dJ;
+    d2r_exp(a_in, dJ);
+
+    Eigen::Matrix<Scalar, 10, 10> Jinv;
+    dr_expinv(a_in, Jinv);
+
+    // both products skip the (structurally) zero elements of J^-1, and are evaluated in row-major
+    // storage so that all updates are on contiguous memory
+    const Eigen::Matrix<Scalar, 10, 100, Eigen::RowMajor> dJr = dJ;
+    Eigen::Matrix<Scalar, 10, 100, Eigen::RowMajor> JdJ, Hr;
+    JdJ.setZero();
+    Hr.setZero();
+    for (auto i = 0u; i < 10; ++i) {
+      for (auto k = 0u; k < 10; ++k) {
+        if (Jinv(i, k) != Scalar(0)) { JdJ.row(k) += Jinv(i, k) * dJr.row(i); }
+      }
+    }
+    for (auto i = 0u; i < 10; ++i) {
+      for (auto k = 0u; k < 10; ++k) {
+        if (Jinv(i, k) != Scalar(0)) {
+          Hr.template middleCols<10>(10 * i) -= Jinv(i, k) * JdJ.template middleCols<10>(10 * k);
+        }
+      }
+    }
+    H_out = Hr;
+  }
 };
 
 SMOOTH_END_NAMESPACE
@@ -0,0 +1,338 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+#include <cmath>
+
+#include <Eigen/Core>
+
+#include "common.hpp"
+#include "se3.hpp"
+#include "so3.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief Batched Lie group operations on structure-of-arrays storage.
+ *
+ * Elements are stored as a row-major RepSize x N matrix so that each coefficient is contiguous in
+ * memory. The generic implementation falls back to the scalar Impl on each element, and
+ * specializations for common groups operate on whole rows so that Eigen can vectorize.
+ *
+ * All functions return new arrays and are therefore safe to use with aliased arguments.
+ */
+template<typename Impl>
+struct LieArrayImpl
+{
+  // \cond
+  using Scalar = typename Impl::Scalar;
+  using GArray = Eigen::Matrix<Scalar, Impl::RepSize, -1, Eigen::RowMajor>;
+  using TArray = Eigen::Matrix<Scalar, Impl::Dof, -1, Eigen::RowMajor>;
+  using GElem  = Eigen::Matrix<Scalar, Impl::RepSize, 1>;
+  using TElem  = Eigen::Matrix<Scalar, Impl::Dof, 1>;
+  using MElem  = Eigen::Matrix<Scalar, Impl::Dim, Impl::Dim>;
+  // \endcond
+
+  /// @brief Batched composition.
+  static GArray composition(const GArray & g1, const GArray & g2)
+  {
+    GArray ret(Impl::RepSize, g1.cols());
+    GElem tmp;
+    for (Eigen::Index i = 0; i < g1.cols(); ++i) {
+      Impl::composition(g1.col(i), g2.col(i), tmp);
+      ret.col(i) = tmp;
+    }
+    return ret;
+  }
+
+  /// @brief Batched inverse.
+  static GArray inverse(const GArray & g)
+  {
+    GArray ret(Impl::RepSize, g.cols());
+    GElem tmp;
+    for (Eigen::Index i = 0; i < g.cols(); ++i) {
+      Impl::inverse(g.col(i), tmp);
+      ret.col(i) = tmp;
+    }
+    return ret;
+  }
+
+  /// @brief Batched log.
+  static TArray log(const GArray & g)
+  {
+    TArray ret(Impl::Dof, g.cols());
+    TElem tmp;
+    for (Eigen::Index i = 0; i < g.cols(); ++i) {
+      Impl::log(g.col(i), tmp);
+      ret.col(i) = tmp;
+    }
+    return ret;
+  }
+
+  /// @brief Batched exp.
+  static GArray exp(const TArray & a)
+  {
+    GArray ret(Impl::RepSize, a.cols());
+    GElem tmp;
+    for (Eigen::Index i = 0; i < a.cols(); ++i) {
+      Impl::exp(a.col(i), tmp);
+      ret.col(i) = tmp;
+    }
+    return ret;
+  }
+
+  /**
+   * @brief Batched action on vectors via the matrix representation.
+   *
+   * If N = Dim the matrix acts directly on vectors, if N = Dim - 1 vectors are treated as
+   * homogeneous coordinates.
+   */
+  template<int N>
+    requires(N == Impl::Dim || N + 1 == Impl::Dim)
+  static Eigen::Matrix<Scalar, N, -1, Eigen::RowMajor>
+  act(const GArray & g, const Eigen::Matrix<Scalar, N, -1, Eigen::RowMajor> & v)
+  {
+    Eigen::Matrix<Scalar, N, -1, Eigen::RowMajor> ret(N, v.cols());
+    MElem M;
+    for (Eigen::Index i = 0; i < g.cols(); ++i) {
+      Impl::matrix(g.col(i), M);
+      if constexpr (N == Impl::Dim) {
+        ret.col(i) = M * v.col(i);
+      } else {
+        ret.col(i) = M.template topLeftCorner<N, N>() * v.col(i) + M.template topRightCorner<N, 1>();
+      }
+    }
+    return ret;
+  }
+};
+
+// \cond
+namespace detail {
+
+/// @brief Row-wise cross product between two 3 x N arrays.
+template<typename D1, typename D2>
+Eigen::Array<typename D1::Scalar, 3, -1, Eigen::RowMajor>
+array_cross(const Eigen::ArrayBase<D1> & a, const Eigen::ArrayBase<D2> & b)
+{
+  Eigen::Array<typename D1::Scalar, 3, -1, Eigen::RowMajor> ret(3, a.cols());
+  ret.row(0) = a.row(1) * b.row(2) - a.row(2) * b.row(1);
+  ret.row(1) = a.row(2) * b.row(0) - a.row(0) * b.row(2);
+  ret.row(2) = a.row(0) * b.row(1) - a.row(1) * b.row(0);
+  return ret;
+}
+
+/// @brief Rotate a 3 x N array of vectors with a 4 x N array of quaternions.
+template<typename D1, typename D2>
+Eigen::Array<typename D1::Scalar, 3, -1, Eigen::RowMajor>
+array_rotate(const Eigen::ArrayBase<D1> & q, const Eigen::ArrayBase<D2> & v)
+{
+  // v + 2 w (q x v) + 2 q x (q x v)
+  const auto qv = q.template topRows<3>();
+
+  const Eigen::Array<typename D1::Scalar, 3, -1, Eigen::RowMajor> t = typename D1::Scalar(2) * array_cross(qv, v);
+  return v + t.rowwise() * q.row(3) + array_cross(qv, t);
+}
+
+}  // namespace detail
+// \endcond
+
+/// @brief Batched SO3 operations.
+template<typename _Scalar>
+struct LieArrayImpl<SO3Impl<_Scalar>>
+{
+  // \cond
+  using Scalar = _Scalar;
+  using GArray = Eigen::Matrix<Scalar, 4, -1, Eigen::RowMajor>;
+  using TArray = Eigen::Matrix<Scalar, 3, -1, Eigen::RowMajor>;
+  using Row    = Eigen::Array<Scalar, 1, -1>;
+  // \endcond
+
+  /// @brief Flip sign of quaternions to ensure qw >= 0.
+  static void normalize_sign(Eigen::Ref<GArray> g)
+  {
+    const Row sign = (g.row(3).array() < Scalar(0)).select(Row::Constant(g.cols(), Scalar(-1)), Row::Ones(g.cols()));
+    g.array().rowwise() *= sign;
+  }
+
+  /// @brief Batched composition.
+  template<typename D1, typename D2>
+  static GArray composition(const Eigen::MatrixBase<D1> & g1, const Eigen::MatrixBase<D2> & g2)
+  {
+    const auto x1 = g1.row(0).array(), y1 = g1.row(1).array(), z1 = g1.row(2).array(), w1 = g1.row(3).array();
+    const auto x2 = g2.row(0).array(), y2 = g2.row(1).array(), z2 = g2.row(2).array(), w2 = g2.row(3).array();
+
+    GArray ret(4, g1.cols());
+    ret.row(0) = (w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2).matrix();
+    ret.row(1) = (w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2).matrix();
+    ret.row(2) = (w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2).matrix();
+    ret.row(3) = (w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2).matrix();
+    normalize_sign(ret);
+    return ret;
+  }
+
+  /// @brief Batched inverse.
+  template<typename D>
+  static GArray inverse(const Eigen::MatrixBase<D> & g)
+  {
+    GArray ret = g;
+    ret.template topRows<3>() *= Scalar(-1);
+    return ret;
+  }
+
+  /// @brief Batched log.
+  template<typename D>
+  static TArray log(const Eigen::MatrixBase<D> & g)
+  {
+    const auto w   = g.row(3).array();
+    const Row xyz2 = g.template topRows<3>().array().square().colwise().sum();
+
+    if constexpr (detail::use_fast_math<Scalar>) {
+      if ((w >= Scalar(0)).all()) {
+        TArray ret = g.template topRows<3>();
+        ret.array().rowwise() *= detail::fast::log_scale<Scalar, Row>(xyz2, Row(w));
+        return ret;
+      }
+    }
+
+    const Row xyz   = xyz2.sqrt();
+    const Row small = Scalar(2) / w - Scalar(2) * xyz2 / (Scalar(3) * w * w * w);
+    const Row large = Scalar(2) * xyz.binaryExpr(w, [](Scalar y, Scalar x) { return std::atan2(y, x); }) / xyz;
+    const Row phi   = (xyz2 < Scalar(eps2)).select(small, large);
+
+    TArray ret = g.template topRows<3>();
+    ret.array().rowwise() *= phi;
+    return ret;
+  }
+
+  /// @brief Batched exp.
+  template<typename D>
+  static GArray exp(const Eigen::MatrixBase<D> & a)
+  {
+    const Row th2 = a.array().square().colwise().sum();
+
+    if constexpr (detail::use_fast_math<Scalar>) {
+      if ((th2 <= detail::fast::max_x2<Scalar>).all()) {
+        GArray ret(4, a.cols());
+        ret.template topRows<3>() = a;
+        ret.template topRows<3>().array().rowwise() *= detail::fast::sinc_half<Scalar, Row>(th2);
+        ret.row(3) = detail::fast::cos_half<Scalar, Row>(th2).matrix();
+        normalize_sign(ret);
+        return ret;
+      }
+    }
+
+    const Row th  = th2.sqrt();
+    const Row A   = (th2 < Scalar(eps2)).select(Scalar(1) / Scalar(2) - th2 / Scalar(48), (th / Scalar(2)).sin() / th);
+    const Row B   = (th2 < Scalar(eps2)).select(Scalar(1) - th2 / Scalar(8), (th / Scalar(2)).cos());
+
+    GArray ret(4, a.cols());
+    ret.template topRows<3>() = a;
+    ret.template topRows<3>().array().rowwise() *= A;
+    ret.row(3) = B.matrix();
+    normalize_sign(ret);
+    return ret;
+  }
+
+  /// @brief Batched rotation of vectors.
+  template<int N>
+    requires(N == 3)
+  static Eigen::Matrix<Scalar, 3, -1, Eigen::RowMajor>
+  act(const GArray & g, const Eigen::Matrix<Scalar, 3, -1, Eigen::RowMajor> & v)
+  {
+    return detail::array_rotate(g.array(), v.array()).matrix();
+  }
+};
+
+/// @brief Batched SE3 operations.
+template<typename _Scalar>
+struct LieArrayImpl<SE3Impl<_Scalar>>
+{
+  // \cond
+  using Scalar = _Scalar;
+  using GArray = Eigen::Matrix<Scalar, 7, -1, Eigen::RowMajor>;
+  using TArray = Eigen::Matrix<Scalar, 6, -1, Eigen::RowMajor>;
+  using Row    = Eigen::Array<Scalar, 1, -1>;
+  using SO3Arr = LieArrayImpl<SO3Impl<Scalar>>;
+  // \endcond
+
+  /// @brief Batched composition.
+  static GArray composition(const GArray & g1, const GArray & g2)
+  {
+    GArray ret(7, g1.cols());
+    ret.template bottomRows<4>() = SO3Arr::composition(g1.template bottomRows<4>(), g2.template bottomRows<4>());
+    ret.template topRows<3>() =
+      g1.template topRows<3>()
+      + detail::array_rotate(g1.template bottomRows<4>().array(), g2.template topRows<3>().array()).matrix();
+    return ret;
+  }
+
+  /// @brief Batched inverse.
+  static GArray inverse(const GArray & g)
+  {
+    GArray ret(7, g.cols());
+    ret.template bottomRows<4>() = SO3Arr::inverse(g.template bottomRows<4>());
+    ret.template topRows<3>() =
+      -detail::array_rotate(ret.template bottomRows<4>().array(), g.template topRows<3>().array()).matrix();
+    return ret;
+  }
+
+  /// @brief Batched log.
+  static TArray log(const GArray & g)
+  {
+    TArray ret(6, g.cols());
+    ret.template bottomRows<3>() = SO3Arr::log(g.template bottomRows<4>());
+
+    // translation part is S1inv(w) * t = t - (w x t) / 2 + A * w x (w x t)
+    const auto w  = ret.template bottomRows<3>().array();
+    const auto t  = g.template topRows<3>().array();
+    const Row th2 = w.square().colwise().sum();
+    const Row th  = th2.sqrt();
+    const Row A   = (th2 < Scalar(eps2))
+                    .select(
+                      Scalar(1) / Scalar(12) + th2 / Scalar(720),
+                      Scalar(1) / th2 - (Scalar(1) + th.cos()) / (Scalar(2) * th * th.sin()));
+
+    const Eigen::Array<Scalar, 3, -1, Eigen::RowMajor> wxt = detail::array_cross(w, t);
+
+    ret.template topRows<3>() = (t - wxt / Scalar(2) + detail::array_cross(w, wxt).rowwise() * A).matrix();
+    return ret;
+  }
+
+  /// @brief Batched exp.
+  static GArray exp(const TArray & a)
+  {
+    GArray ret(7, a.cols());
+    ret.template bottomRows<4>() = SO3Arr::exp(a.template bottomRows<3>());
+
+    // translation part is S1(w) * v = v - cos_2 * (w x v) - sin_3 * w x (w x v)
+    const auto v  = a.template topRows<3>().array();
+    const auto w  = a.template bottomRows<3>().array();
+    const Row th2 = w.square().colwise().sum();
+    const Row th  = th2.sqrt();
+    const Row c2  = (th2 > Scalar(eps2))
+                     .select(
+                       (th.cos() - Scalar(1)) / th2,
+                       -Scalar(1) / Scalar(2) + th2 / Scalar(24) - th2 * th2 / Scalar(720));
+    const Row s3 = (th2 > Scalar(eps2))
+                     .select(
+                       (th.sin() - th) / (th2 * th),
+                       -Scalar(1) / Scalar(6) + th2 / Scalar(120) - th2 * th2 / Scalar(5040));
+
+    const Eigen::Array<Scalar, 3, -1, Eigen::RowMajor> wxv = detail::array_cross(w, v);
+
+    ret.template topRows<3>() =
+      (v - wxv.rowwise() * c2 - detail::array_cross(w, wxv).rowwise() * s3).matrix();
+    return ret;
+  }
+
+  /// @brief Batched transformation of vectors.
+  template<int N>
+    requires(N == 3)
+  static Eigen::Matrix<Scalar, 3, -1, Eigen::RowMajor>
+  act(const GArray & g, const Eigen::Matrix<Scalar, 3, -1, Eigen::RowMajor> & v)
+  {
+    return g.template topRows<3>() + detail::array_rotate(g.template bottomRows<4>().array(), v.array()).matrix();
+  }
+};
+
+SMOOTH_END_NAMESPACE
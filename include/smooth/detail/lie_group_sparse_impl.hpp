@@ -12,6 +12,8 @@ template<typename D> class C1Base;
 template<typename D> class SE2Base;
 template<typename D> class SE3Base;
 template<typename D> class SO2Base;
+template<typename D> class SE_K_3Base;
+template<typename D> class GalileiBase;
 template<typename D> class BundleBase;
 // clang-format on
 
@@ -177,6 +179,108 @@ struct lie_sparse<G>
   }();
 };
 
+/// @brief Sparsity info for SE_K_3 types.
+template<typename G>
+  requires(std::is_base_of_v<SE_K_3Base<G>, G>)
+struct lie_sparse<G>
+{
+  /// @brief Number of R3 variables
+  static constexpr auto K = G::K;
+
+  /// @brief Sparsity pattern for dr_exp / dr_expinv
+  static inline Eigen::SparseMatrix<Scalar<G>> d_exp_sparse_pattern = [] {
+    Eigen::SparseMatrix<Scalar<G>> ret(Dof<G>, Dof<G>);
+    for (auto k = 0; k <= K; ++k) {
+      for (auto i = 0; i < 3; ++i) {
+        for (auto j = 0; j < 3; ++j) {
+          // diagonal blocks
+          ret.insert(3 * k + i, 3 * k + j) = (i == j) ? Scalar<G>(1) : Scalar<G>(0);
+          // last block column
+          if (k < K) { ret.insert(3 * k + i, 3 * K + j) = Scalar<G>(0); }
+        }
+      }
+    }
+    ret.makeCompressed();
+    return ret;
+  }();
+
+  /// @brief Sparsity pattern for d2r_exp / d2r_expinv
+  static inline Eigen::SparseMatrix<Scalar<G>> d2_exp_sparse_pattern = [] {
+    Eigen::SparseMatrix<Scalar<G>> ret(Dof<G>, Dof<G> * Dof<G>);
+    // entry (c, Dof * r + t) is the derivative of dr_exp(r, c) w.r.t. a(t)
+    for (auto k = 0; k <= K; ++k) {
+      for (auto i = 0; i < 3; ++i) {
+        for (auto j = 0; j < 3; ++j) {
+          for (auto l = 0; l < 3; ++l) {
+            // d dr_exp[vk, vk] / dw (d dr_exp[w, w] / dw for k = K)
+            ret.insert(3 * k + j, Dof<G> * (3 * k + i) + 3 * K + l) = Scalar<G>(0);
+            if (k < K) {
+              // d dr_exp[vk, w] / dvk
+              ret.insert(3 * K + j, Dof<G> * (3 * k + i) + 3 * k + l) = Scalar<G>(0);
+              // d dr_exp[vk, w] / dw
+              ret.insert(3 * K + j, Dof<G> * (3 * k + i) + 3 * K + l) = Scalar<G>(0);
+            }
+          }
+        }
+      }
+    }
+    ret.makeCompressed();
+    return ret;
+  }();
+};
+
+/// @brief Sparsity info for Galilei types.
+template<typename G>
+  requires(std::is_base_of_v<GalileiBase<G>, G>)
+struct lie_sparse<G>
+{
+  /// @brief Sparsity pattern for dr_exp / dr_expinv
+  static inline Eigen::SparseMatrix<Scalar<G>> d_exp_sparse_pattern = [] {
+    Eigen::SparseMatrix<Scalar<G>> ret(10, 10);
+    // dr_exp rows [r0, r0 + nr) x cols [c0, c0 + nc)
+    const auto insert_block = [&ret](int r0, int nr, int c0, int nc) {
+      for (auto i = r0; i < r0 + nr; ++i) {
+        for (auto j = c0; j < c0 + nc; ++j) { ret.insert(i, j) = (i == j) ? Scalar<G>(1) : Scalar<G>(0); }
+      }
+    };
+    insert_block(0, 3, 0, 3);  // dr_exp[b, b]
+    insert_block(0, 3, 7, 3);  // dr_exp[b, w]
+    insert_block(3, 3, 0, 3);  // dr_exp[q, b]
+    insert_block(3, 3, 3, 3);  // dr_exp[q, q]
+    insert_block(3, 3, 6, 1);  // dr_exp[q, s]
+    insert_block(3, 3, 7, 3);  // dr_exp[q, w]
+    insert_block(6, 1, 6, 1);  // dr_exp[s, s]
+    insert_block(7, 3, 7, 3);  // dr_exp[w, w]
+    ret.makeCompressed();
+    return ret;
+  }();
+
+  /// @brief Sparsity pattern for d2r_exp / d2r_expinv
+  static inline Eigen::SparseMatrix<Scalar<G>> d2_exp_sparse_pattern = [] {
+    Eigen::SparseMatrix<Scalar<G>> ret(10, 100);
+    // entry (c, 10 * r + t) is the derivative of dr_exp(r, c) w.r.t. a(t). The lambda inserts the
+    // derivatives of dr_exp rows [r0, r0 + nr) x cols [c0, c0 + nc) w.r.t. a(t) for t in [t0, t0 + nt)
+    const auto insert_block = [&ret](int r0, int nr, int c0, int nc, int t0, int nt) {
+      for (auto r = r0; r < r0 + nr; ++r) {
+        for (auto c = c0; c < c0 + nc; ++c) {
+          for (auto t = t0; t < t0 + nt; ++t) { ret.insert(c, 10 * r + t) = Scalar<G>(0); }
+        }
+      }
+    };
+    insert_block(0, 3, 0, 3, 7, 3);   // d dr_exp[b, b] / dw
+    insert_block(0, 3, 7, 3, 0, 3);   // d dr_exp[b, w] / db
+    insert_block(0, 3, 7, 3, 7, 3);   // d dr_exp[b, w] / dw
+    insert_block(3, 3, 0, 3, 6, 4);   // d dr_exp[q, b] / d(s, w)
+    insert_block(3, 3, 3, 3, 7, 3);   // d dr_exp[q, q] / dw
+    insert_block(3, 3, 6, 1, 0, 3);   // d dr_exp[q, s] / db
+    insert_block(3, 3, 6, 1, 7, 3);   // d dr_exp[q, s] / dw
+    insert_block(3, 3, 7, 3, 0, 10);  // d dr_exp[q, w] / d(b, q, s, w)
+    insert_block(7, 3, 7, 3, 7, 3);   // d dr_exp[w, w] / dw
+    ret.makeCompressed();
+    return ret;
+  }();
+};
+
 /// @brief Sparsity info for Bundle types.
 template<typename G>
   requires(std::is_base_of_v<BundleBase<G>, G>)
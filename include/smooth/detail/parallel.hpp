@@ -0,0 +1,54 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "smooth/version.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+namespace detail {
+
+/**
+ * @brief Number of chunks to split N work items into.
+ *
+ * @param N number of work items
+ * @param num_threads maximal number of threads, 0 means std::thread::hardware_concurrency()
+ * @param min_chunk minimal number of work items per chunk
+ */
+inline std::size_t parallel_num_chunks(std::size_t N, std::size_t num_threads, std::size_t min_chunk)
+{
+  if (num_threads == 0) { num_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1); }
+  min_chunk = std::max<std::size_t>(min_chunk, 1);
+  return std::clamp<std::size_t>((N + min_chunk - 1) / min_chunk, 1, num_threads);
+}
+
+/**
+ * @brief Call f(begin, end, chunk) for C contiguous chunks that partition [0, N).
+ *
+ * Chunk 0 is processed on the calling thread and chunks 1, ..., C - 1 on worker threads. Returns
+ * once all chunks are processed. The partition only depends on N and C, so chunk-wise reductions
+ * that are combined in chunk order are deterministic.
+ *
+ * @note f must not throw.
+ */
+template<typename F>
+void parallel_for_chunks(std::size_t N, std::size_t C, F && f)
+{
+  C = std::max<std::size_t>(C, 1);
+
+  const auto begin = [&](std::size_t c) { return c * N / C; };
+
+  std::vector<std::jthread> workers;
+  workers.reserve(C - 1);
+  for (std::size_t c = 1; c < C; ++c) { workers.emplace_back([&f, b = begin(c), e = begin(c + 1), c] { f(b, e, c); }); }
+  f(begin(0), begin(1), std::size_t{0});
+}
+
+}  // namespace detail
+
+SMOOTH_END_NAMESPACE
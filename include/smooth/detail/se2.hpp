@@ -197,6 +197,112 @@ public:
     A_out.noalias() = Eigen::Matrix3<Scalar>::Identity() + ad_a / 2 + A * ad_a * ad_a;
   }
 
+  static void exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out)
+  {
+    using std::cos, std::sin;
+
+    const Scalar th  = a_in.z();
+    const Scalar th2 = th * th;
+    const Scalar sTh = sin(th);
+    const Scalar cTh = cos(th);
+
+    const auto [c2, s3] = [&]() -> std::array<Scalar, 2> {
+      if (th2 < Scalar(eps2)) {
+        return {
+          -Scalar(1) / Scalar(2) + th2 / Scalar(24) - th2 * th2 / Scalar(720),
+          -Scalar(1) / Scalar(6) + th2 / Scalar(120) - th2 * th2 / Scalar(5040),
+        };
+      } else {
+        return {
+          (cTh - Scalar(1)) / th2,
+          (sTh - th) / (th2 * th),
+        };
+      }
+    }();
+
+    // sin(th) / th and (cos(th) - 1) / th
+    const Scalar A = Scalar(1) + th2 * s3;
+    const Scalar B = th * c2;
+
+    const Eigen::Matrix<Scalar, 2, 2> S{{A, B}, {-B, A}};
+
+    g_out.template head<2>().noalias() = S * a_in.template head<2>();
+    g_out.template tail<2>() << sTh, cTh;
+
+    Eigen::Matrix3<Scalar> ad_a;
+    ad(a_in, ad_a);
+    A_out.noalias() = Eigen::Matrix3<Scalar>::Identity() + c2 * ad_a - s3 * ad_a * ad_a;
+  }
+
+  static void log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out)
+  {
+    using std::tan;
+
+    Eigen::Matrix<Scalar, 1, 1> so2_log;
+    SO2Impl<Scalar>::log(g_in.template tail<2>(), so2_log);
+    const Scalar th  = so2_log(0);
+    const Scalar th2 = th * th;
+
+    // (1 + cos th) / (2 th sin th) = (th / 2) / tan(th / 2) / th2
+    const Scalar B    = th / Scalar(2);
+    const auto [A, C] = [&]() -> std::array<Scalar, 2> {
+      if (th2 < Scalar(eps2)) {
+        return {
+          Scalar(1) - th2 / Scalar(12),
+          Scalar(1) / Scalar(12) + th2 / Scalar(720),
+        };
+      } else {
+        const Scalar A0 = B / tan(B);
+        return {A0, (Scalar(1) - A0) / th2};
+      }
+    }();
+
+    const Eigen::Matrix<Scalar, 2, 2> Sinv{{A, B}, {-B, A}};
+
+    a_out.template head<2>().noalias() = Sinv * g_in.template head<2>();
+    a_out(2)                           = th;
+
+    Eigen::Matrix3<Scalar> ad_a;
+    ad(a_out, ad_a);
+    A_out.noalias() = Eigen::Matrix3<Scalar>::Identity() + ad_a / 2 + C * ad_a * ad_a;
+  }
+
+  /**
+   * @brief Fused between-residual rminus(g1^-1 * g2, z) and its jacobians w.r.t. g1 and g2.
+   */
+  static void between_rminus(
+    GRefIn g_in1, GRefIn g_in2, GRefIn z_in, TRefOut a_out, TMapRefOut J1_out, TMapRefOut J2_out)
+  {
+    const Scalar c1 = g_in1(3), s1 = g_in1(2);
+    const Scalar cz = z_in(3), sz = z_in(2);
+
+    // d = g1^-1 * g2
+    const Scalar sd  = c1 * g_in2(2) - s1 * g_in2(3);
+    const Scalar cd  = c1 * g_in2(3) + s1 * g_in2(2);
+    const Scalar dx  = g_in2(0) - g_in1(0);
+    const Scalar dy  = g_in2(1) - g_in1(1);
+    const Scalar tdx = c1 * dx + s1 * dy;
+    const Scalar tdy = -s1 * dx + c1 * dy;
+
+    // e = z^-1 * d
+    const Scalar ex = tdx - z_in(0);
+    const Scalar ey = tdy - z_in(1);
+    Eigen::Matrix<Scalar, 4, 1> e;
+    e << cz * ex + sz * ey, -sz * ex + cz * ey, cz * sd - sz * cd, cz * cd + sz * sd;
+
+    log_dr_expinv(e, a_out, J2_out);
+
+    // Ad_{d^-1} = [Rd^T  (ty', -tx') ; 0  1] with t' = -Rd^T td, bottom row is not multiplied
+    const Scalar ty_inv = sd * tdx - cd * tdy;
+    const Scalar tx_inv = -cd * tdx - sd * tdy;
+    for (auto i = 0u; i < 3; ++i) {
+      const Scalar j0 = J2_out(i, 0), j1 = J2_out(i, 1);
+      J1_out(i, 0)    = -(cd * j0 - sd * j1);
+      J1_out(i, 1)    = -(sd * j0 + cd * j1);
+      J1_out(i, 2)    = -(ty_inv * j0 - tx_inv * j1 + J2_out(i, 2));
+    }
+  }
+
   static void d2r_exp(TRefIn a_in, THessRefOut H_out)
   {
     const auto [A, B, dA_dwz, dB_dwz] = [&]() -> std::array<Scalar, 4> {
@@ -8,6 +8,7 @@
 
 #include "../derivatives.hpp"
 #include "common.hpp"
+#include "congruence.hpp"
 #include "so3.hpp"
 
 SMOOTH_BEGIN_NAMESPACE
@@ -149,9 +150,15 @@ public:
   static Eigen::Matrix<Scalar, 3, 3>
   calculate_q(Eigen::Ref<const Eigen::Vector3<Scalar>> v, Eigen::Ref<const Eigen::Vector3<Scalar>> w)
   {
-    using detail::sin_3, detail::cos_4, detail::sin_5;
-    const Scalar th2 = w.squaredNorm();
+    return calculate_q(v, w, detail::trig_tails<Scalar>(w.squaredNorm()));
+  }
 
+  /// @brief Calculate Q with precomputed Taylor tails of |w|.
+  static Eigen::Matrix<Scalar, 3, 3> calculate_q(
+    Eigen::Ref<const Eigen::Vector3<Scalar>> v,
+    Eigen::Ref<const Eigen::Vector3<Scalar>> w,
+    const detail::TrigTails<Scalar> & tails)
+  {
     Eigen::Matrix<Scalar, 3, 3> V, W;
     SO3Impl<Scalar>::hat(v, V);
     SO3Impl<Scalar>::hat(w, W);
@@ -161,9 +168,9 @@ public:
 
     // clang-format off
     return Scalar(0.5) * V
-      + sin_3(th2) * (-WV - VW + vdw * W)
-      + cos_4(th2) * (W * WV + VW * W + vdw * (Scalar(3) * W - WW))
-      + sin_5(th2) * Scalar(3) * vdw * WW;
+      + tails.s3 * (-WV - VW + vdw * W)
+      + tails.c4 * (W * WV + VW * W + vdw * (Scalar(3) * W - WW))
+      + tails.s5 * Scalar(3) * vdw * WW;
     // clang-format on
   }
 
@@ -305,6 +312,93 @@ public:
     A_out.template bottomLeftCorner<3, 3>().setZero();
   }
 
+  static void exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out)
+  {
+    const auto tails = SO3Impl<Scalar>::exp_dr_exp(
+      a_in.template tail<3>(), g_out.template tail<4>(), A_out.template topLeftCorner<3, 3>());
+
+    // S1(w) * v = v - cos_2 * (w x v) - sin_3 * w x (w x v)
+    Eigen::Matrix3<Scalar> W;
+    SO3Impl<Scalar>::hat(a_in.template tail<3>(), W);
+    const Eigen::Vector3<Scalar> Wv = W * a_in.template head<3>();
+    g_out.template head<3>()        = a_in.template head<3>() - tails.c2 * Wv - tails.s3 * W * Wv;
+
+    A_out.template topRightCorner<3, 3>()    = calculate_q(-a_in.template head<3>(), -a_in.template tail<3>(), tails);
+    A_out.template bottomRightCorner<3, 3>() = A_out.template topLeftCorner<3, 3>();
+    A_out.template bottomLeftCorner<3, 3>().setZero();
+  }
+
+  static void log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out)
+  {
+    const auto tails = SO3Impl<Scalar>::log_dr_expinv(
+      g_in.template tail<4>(), a_out.template tail<3>(), A_out.template topLeftCorner<3, 3>());
+
+    // S1inv(w) = dr_expinv(w) - hat(w)
+    Eigen::Matrix3<Scalar> W;
+    SO3Impl<Scalar>::hat(a_out.template tail<3>(), W);
+    a_out.template head<3>().noalias() = (A_out.template topLeftCorner<3, 3>() - W) * g_in.template head<3>();
+
+    A_out.template topRightCorner<3, 3>().noalias() =
+      -A_out.template topLeftCorner<3, 3>() * calculate_q(-a_out.template head<3>(), -a_out.template tail<3>(), tails)
+      * A_out.template topLeftCorner<3, 3>();
+    A_out.template bottomRightCorner<3, 3>() = A_out.template topLeftCorner<3, 3>();
+    A_out.template bottomLeftCorner<3, 3>().setZero();
+  }
+
+  /**
+   * @brief Fused between-residual rminus(g1^-1 * g2, z) and its jacobians w.r.t. g1 and g2.
+   */
+  static void between_rminus(
+    GRefIn g_in1, GRefIn g_in2, GRefIn z_in, TRefOut a_out, TMapRefOut J1_out, TMapRefOut J2_out)
+  {
+    Eigen::Map<const Eigen::Quaternion<Scalar>> q1(g_in1.data() + 3);
+    Eigen::Map<const Eigen::Quaternion<Scalar>> q2(g_in2.data() + 3);
+    Eigen::Map<const Eigen::Quaternion<Scalar>> qz(z_in.data() + 3);
+
+    // d = g1^-1 * g2
+    const Eigen::Quaternion<Scalar> qd = q1.conjugate() * q2;
+    const Eigen::Vector3<Scalar> td    = q1.conjugate() * (g_in2.template head<3>() - g_in1.template head<3>());
+
+    // e = z^-1 * d
+    Eigen::Matrix<Scalar, 7, 1> e;
+    e.template head<3>() = qz.conjugate() * (td - z_in.template head<3>());
+    e.template tail<4>() = (qz.conjugate() * qd).coeffs();
+    if (e(6) < Scalar(0)) { e.template tail<4>() *= Scalar(-1); }
+
+    log_dr_expinv(e, a_out, J2_out);
+
+    // Ad_{d^-1} = [Rd^T  -Rd^T td^ ; 0  Rd^T], multiply by blocks to skip the zero block
+    const Eigen::Matrix3<Scalar> RdT = qd.toRotationMatrix().transpose();
+    Eigen::Matrix3<Scalar> Td;
+    SO3Impl<Scalar>::hat(td, Td);
+
+    const Eigen::Matrix<Scalar, 6, 3> M = J2_out.template leftCols<3>() * RdT;
+
+    J1_out.template leftCols<3>()            = -M;
+    J1_out.template rightCols<3>().noalias() = M * Td;
+    J1_out.template rightCols<3>().noalias() -= J2_out.template rightCols<3>() * RdT;
+  }
+
+  /**
+   * @brief Covariance transport Ad P Ad' that skips the zero blocks of Ad.
+   */
+  static void Ad_cov(GRefIn g_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, 6, 6> A;
+    Ad(g_in, A);
+    detail::block_arrow_congruence<1>(A, P_in, P_out);
+  }
+
+  /**
+   * @brief Covariance transport dr_exp P dr_exp' that skips the zero blocks of dr_exp.
+   */
+  static void dr_exp_cov(TRefIn a_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, 6, 6> A;
+    dr_exp(a_in, A);
+    detail::block_arrow_congruence<1>(A, P_in, P_out);
+  }
+
   static void d2r_exp(TRefIn a_in, THessRefOut H_out)
   {
     H_out.setZero();
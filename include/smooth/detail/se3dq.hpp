@@ -0,0 +1,189 @@
+// Copyright (C) 2021-2022 Petter Nilsson. MIT License.
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "common.hpp"
+#include "se3.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief SE(3) Lie Group represented as unit dual quaternions
+ *
+ * Memory layout
+ * -------------
+ * Group:    rx ry rz rw dx dy dz dw
+ * Tangent:  vx vy vz Ωx Ωy Ωz
+ *
+ * where r = [rx ry rz rw] is the real part (rotation) and d = [dx dy dz dw] = 1/2 (T, 0) ⊗ r is the
+ * dual part. The tangent space and matrix forms are identical to SE3Impl.
+ *
+ * Lie group Matrix form
+ * ---------------------
+ * [ R T ]
+ * [ 0 1 ]
+ *
+ * where R ∈ SO(3) and T = [x y z] ∈ R3
+ *
+ * Lie algebra Matrix form
+ * -----------------------
+ * [  0 -Ωz  Ωy vx]
+ * [  Ωz  0 -Ωx vy]
+ * [ -Ωy Ωx   0 vz]
+ * [   0  0   0  0]
+ *
+ * Constraints
+ * -----------
+ * Group:   rx * rx + ry * ry + rz * rz + rw * rw = 1, rx * dx + ry * dy + rz * dz + rw * dw = 0, rw >= 0
+ * Tangent: -pi < Ωx Ωy Ωz <= pi
+ */
+template<typename _Scalar>
+class SE3DQImpl
+{
+public:
+  using Scalar = _Scalar;
+
+  static constexpr int RepSize        = 8;
+  static constexpr int Dim            = 4;
+  static constexpr int Dof            = 6;
+  static constexpr bool IsCommutative = false;
+
+  SMOOTH_DEFINE_REFS;
+
+  /// @brief Convert from SE3Impl coefficients [x y z qx qy qz qw].
+  static void from_se3(const Eigen::Ref<const Eigen::Matrix<Scalar, 7, 1>> & se3_in, GRefOut g_out)
+  {
+    Eigen::Map<const Eigen::Quaternion<Scalar>> r(se3_in.data() + 3);
+    const Eigen::Quaternion<Scalar> t(Scalar(0), se3_in(0), se3_in(1), se3_in(2));
+
+    g_out.template head<4>() = r.coeffs();
+    g_out.template tail<4>() = Scalar(0.5) * (t * r).coeffs();
+  }
+
+  /// @brief Convert to SE3Impl coefficients [x y z qx qy qz qw].
+  static void to_se3(GRefIn g_in, Eigen::Ref<Eigen::Matrix<Scalar, 7, 1>> se3_out)
+  {
+    Eigen::Map<const Eigen::Quaternion<Scalar>> r(g_in.data());
+    Eigen::Map<const Eigen::Quaternion<Scalar>> d(g_in.data() + 4);
+
+    se3_out.template head<3>() = Scalar(2) * (d * r.conjugate()).vec();
+    se3_out.template tail<4>() = r.coeffs();
+  }
+
+  static void setIdentity(GRefOut g_out)
+  {
+    g_out.setZero();
+    g_out(3) = Scalar(1);
+  }
+
+  static void setRandom(GRefOut g_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    SE3Impl<Scalar>::setRandom(se3);
+    from_se3(se3, g_out);
+  }
+
+  static void matrix(GRefIn g_in, MRefOut m_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    to_se3(g_in, se3);
+    SE3Impl<Scalar>::matrix(se3, m_out);
+  }
+
+  static void composition(GRefIn g_in1, GRefIn g_in2, GRefOut g_out)
+  {
+    // (r1 + e d1) (r2 + e d2) = r1 r2 + e (r1 d2 + d1 r2)
+    const Scalar r1x = g_in1(0), r1y = g_in1(1), r1z = g_in1(2), r1w = g_in1(3);
+    const Scalar d1x = g_in1(4), d1y = g_in1(5), d1z = g_in1(6), d1w = g_in1(7);
+    const Scalar r2x = g_in2(0), r2y = g_in2(1), r2z = g_in2(2), r2w = g_in2(3);
+    const Scalar d2x = g_in2(4), d2y = g_in2(5), d2z = g_in2(6), d2w = g_in2(7);
+
+    const Scalar s = r1w * r2w - r1x * r2x - r1y * r2y - r1z * r2z < Scalar(0) ? Scalar(-1) : Scalar(1);
+
+    // clang-format off
+    g_out(0) = s * (r1w * r2x + r1x * r2w + r1y * r2z - r1z * r2y);
+    g_out(1) = s * (r1w * r2y - r1x * r2z + r1y * r2w + r1z * r2x);
+    g_out(2) = s * (r1w * r2z + r1x * r2y - r1y * r2x + r1z * r2w);
+    g_out(3) = s * (r1w * r2w - r1x * r2x - r1y * r2y - r1z * r2z);
+
+    g_out(4) = s * (r1w * d2x + r1x * d2w + r1y * d2z - r1z * d2y + d1w * r2x + d1x * r2w + d1y * r2z - d1z * r2y);
+    g_out(5) = s * (r1w * d2y - r1x * d2z + r1y * d2w + r1z * d2x + d1w * r2y - d1x * r2z + d1y * r2w + d1z * r2x);
+    g_out(6) = s * (r1w * d2z + r1x * d2y - r1y * d2x + r1z * d2w + d1w * r2z + d1x * r2y - d1y * r2x + d1z * r2w);
+    g_out(7) = s * (r1w * d2w - r1x * d2x - r1y * d2y - r1z * d2z + d1w * r2w - d1x * r2x - d1y * r2y - d1z * r2z);
+    // clang-format on
+  }
+
+  static void inverse(GRefIn g_in, GRefOut g_out)
+  {
+    g_out.template segment<3>(0) = -g_in.template segment<3>(0);
+    g_out(3)                     = g_in(3);
+    g_out.template segment<3>(4) = -g_in.template segment<3>(4);
+    g_out(7)                     = g_in(7);
+  }
+
+  static void log(GRefIn g_in, TRefOut a_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    to_se3(g_in, se3);
+    SE3Impl<Scalar>::log(se3, a_out);
+  }
+
+  static void Ad(GRefIn g_in, TMapRefOut A_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    to_se3(g_in, se3);
+    SE3Impl<Scalar>::Ad(se3, A_out);
+  }
+
+  static void Ad_cov(GRefIn g_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    to_se3(g_in, se3);
+    SE3Impl<Scalar>::Ad_cov(se3, P_in, P_out);
+  }
+
+  static void exp(TRefIn a_in, GRefOut g_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    SE3Impl<Scalar>::exp(a_in, se3);
+    from_se3(se3, g_out);
+  }
+
+  static void hat(TRefIn a_in, MRefOut A_out) { SE3Impl<Scalar>::hat(a_in, A_out); }
+
+  static void vee(MRefIn A_in, TRefOut a_out) { SE3Impl<Scalar>::vee(A_in, a_out); }
+
+  static void ad(TRefIn a_in, TMapRefOut A_out) { SE3Impl<Scalar>::ad(a_in, A_out); }
+
+  static void dr_exp(TRefIn a_in, TMapRefOut A_out) { SE3Impl<Scalar>::dr_exp(a_in, A_out); }
+
+  static void dr_exp_cov(TRefIn a_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    SE3Impl<Scalar>::dr_exp_cov(a_in, P_in, P_out);
+  }
+
+  static void dr_expinv(TRefIn a_in, TMapRefOut A_out) { SE3Impl<Scalar>::dr_expinv(a_in, A_out); }
+
+  static void exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    SE3Impl<Scalar>::exp_dr_exp(a_in, se3, A_out);
+    from_se3(se3, g_out);
+  }
+
+  static void log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out)
+  {
+    Eigen::Matrix<Scalar, 7, 1> se3;
+    to_se3(g_in, se3);
+    SE3Impl<Scalar>::log_dr_expinv(se3, a_out, A_out);
+  }
+
+  static void d2r_exp(TRefIn a_in, THessRefOut H_out) { SE3Impl<Scalar>::d2r_exp(a_in, H_out); }
+
+  static void d2r_expinv(TRefIn a_in, THessRefOut H_out) { SE3Impl<Scalar>::d2r_expinv(a_in, H_out); }
+};
+
+SMOOTH_END_NAMESPACE
@@ -5,6 +5,8 @@
 #include <Eigen/Core>
 
 #include "common.hpp"
+#include "congruence.hpp"
+#include "se3.hpp"
 #include "so3.hpp"
 
 SMOOTH_BEGIN_NAMESPACE
@@ -173,9 +175,15 @@ public:
   static Eigen::Matrix<Scalar, 3, 3>
   calculate_q(Eigen::Ref<const Eigen::Vector3<Scalar>> v, Eigen::Ref<const Eigen::Vector3<Scalar>> w)
   {
-    using detail::sin_3, detail::cos_4, detail::sin_5;
-    const Scalar th2 = w.squaredNorm();
+    return calculate_q(v, w, detail::trig_tails<Scalar>(w.squaredNorm()));
+  }
 
+  /// @brief Calculate Q with precomputed Taylor tails of |w|.
+  static Eigen::Matrix<Scalar, 3, 3> calculate_q(
+    Eigen::Ref<const Eigen::Vector3<Scalar>> v,
+    Eigen::Ref<const Eigen::Vector3<Scalar>> w,
+    const detail::TrigTails<Scalar> & tails)
+  {
     Eigen::Matrix<Scalar, 3, 3> V, W;
     SO3Impl<Scalar>::hat(v, V);
     SO3Impl<Scalar>::hat(w, W);
@@ -185,9 +193,9 @@ public:
 
     // clang-format off
     return Scalar(0.5) * V
-      + sin_3(th2) * (-WV - VW + vdw * W)
-      + cos_4(th2) * (W * WV + VW * W + vdw * (Scalar(3) * W - WW))
-      + sin_5(th2) * Scalar(3) * vdw * WW;
+      + tails.s3 * (-WV - VW + vdw * W)
+      + tails.c4 * (W * WV + VW * W + vdw * (Scalar(3) * W - WW))
+      + tails.s5 * Scalar(3) * vdw * WW;
     // clang-format on
   }
 
@@ -215,6 +223,109 @@ public:
       A_out.template block<3, 3>(3 + 3 * i, 3 + 3 * i) = A_out.template topLeftCorner<3, 3>();
     }
   }
+
+  /**
+   * @brief Covariance transport Ad P Ad' that skips the zero blocks of Ad.
+   */
+  static void Ad_cov(GRefIn g_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, Dof, Dof> A;
+    Ad(g_in, A);
+    detail::block_arrow_congruence<K>(A, P_in, P_out);
+  }
+
+  /**
+   * @brief Covariance transport dr_exp P dr_exp' that skips the zero blocks of dr_exp.
+   */
+  static void dr_exp_cov(TRefIn a_in, TMapRefIn P_in, TMapRefOut P_out)
+  {
+    Eigen::Matrix<Scalar, Dof, Dof> A;
+    dr_exp(a_in, A);
+    detail::block_arrow_congruence<K>(A, P_in, P_out);
+  }
+
+  static void exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out)
+  {
+    A_out.setZero();
+
+    const auto tails = SO3Impl<Scalar>::exp_dr_exp(
+      a_in.template tail<3>(), g_out.template tail<4>(), A_out.template topLeftCorner<3, 3>());
+
+    // S1(w) = I - cos_2 * W - sin_3 * W^2
+    Eigen::Matrix3<Scalar> W;
+    SO3Impl<Scalar>::hat(a_in.template tail<3>(), W);
+    const Eigen::Matrix3<Scalar> S1 = Eigen::Matrix3<Scalar>::Identity() - tails.c2 * W - tails.s3 * W * W;
+
+    for (auto i = 0u; i < K; ++i) {
+      g_out.template segment<3>(3 * i).noalias() = S1 * a_in.template segment<3>(3 * i);
+      A_out.template block<3, 3>(3 * i, 3 * K) =
+        calculate_q(-a_in.template segment<3>(3 * i), -a_in.template tail<3>(), tails);
+      A_out.template block<3, 3>(3 + 3 * i, 3 + 3 * i) = A_out.template topLeftCorner<3, 3>();
+    }
+  }
+
+  static void log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out)
+  {
+    A_out.setZero();
+
+    const auto tails = SO3Impl<Scalar>::log_dr_expinv(
+      g_in.template tail<4>(), a_out.template tail<3>(), A_out.template topLeftCorner<3, 3>());
+
+    // S1inv(w) = dr_expinv(w) - W
+    Eigen::Matrix3<Scalar> W;
+    SO3Impl<Scalar>::hat(a_out.template tail<3>(), W);
+    const Eigen::Matrix3<Scalar> S1inv = A_out.template topLeftCorner<3, 3>() - W;
+
+    for (auto i = 0u; i < K; ++i) {
+      a_out.template segment<3>(3 * i).noalias() = S1inv * g_in.template segment<3>(3 * i);
+      A_out.template block<3, 3>(3 * i, 3 * K).noalias() =
+        -A_out.template topLeftCorner<3, 3>()
+        * calculate_q(-a_out.template segment<3>(3 * i), -a_out.template tail<3>(), tails)
+        * A_out.template topLeftCorner<3, 3>();
+      A_out.template block<3, 3>(3 + 3 * i, 3 + 3 * i) = A_out.template topLeftCorner<3, 3>();
+    }
+  }
+
+  static void d2r_exp(TRefIn a_in, THessRefOut H_out) { d2r_exp_impl<false>(a_in, H_out); }
+
+  static void d2r_expinv(TRefIn a_in, THessRefOut H_out) { d2r_exp_impl<true>(a_in, H_out); }
+
+private:
+  /**
+   * @brief Second derivatives from the SE3 second derivatives of each (vk, w) pair.
+   *
+   * The (vk, vk), (vk, w), and (w, w) blocks of dr_exp (and dr_expinv) are equal to the
+   * corresponding blocks of the SE3 jacobian at (vk, w), and only depend on vk and w.
+   */
+  template<bool Inv>
+  static void d2r_exp_impl(TRefIn a_in, THessRefOut H_out)
+  {
+    H_out.setZero();
+
+    Eigen::Vector<Scalar, 6> a_se3;
+    a_se3.template tail<3>() = a_in.template tail<3>();
+
+    Eigen::Matrix<Scalar, 6, 36> H_se3;
+    for (auto k = 0; k < K; ++k) {
+      a_se3.template head<3>() = a_in.template segment<3>(3 * k);
+      if constexpr (Inv) {
+        SE3Impl<Scalar>::d2r_expinv(a_se3, H_se3);
+      } else {
+        SE3Impl<Scalar>::d2r_exp(a_se3, H_se3);
+      }
+
+      // SE3 index -> SE_K_3 index
+      const auto idx = [k](int m) { return m < 3 ? 3 * k + m : 3 * K + m - 3; };
+
+      for (auto b = 0; b < 6; ++b) {
+        for (auto r = 0; r < 6; r += 3) {
+          for (auto c = 0; c < 6; c += 3) {
+            H_out.template block<3, 3>(idx(r), Dof * idx(b) + idx(c)) = H_se3.template block<3, 3>(r, 6 * b + c);
+          }
+        }
+      }
+    }
+  }
 };
 
 SMOOTH_END_NAMESPACE
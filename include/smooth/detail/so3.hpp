@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <tuple>
+#include <utility>
+
 #include <Eigen/Core>
 
 #include "common.hpp"
@@ -67,6 +70,30 @@ public:
     return Eigen::Matrix3<Scalar>::Identity() / Scalar(2) - sin_3(th2) * M + cos_4(th2) * M * M;
   }
 
+  /// @brief Compute S2 and its derivative w.r.t. a on horizontal Hessian form
+  static std::pair<Eigen::Matrix3<Scalar>, Eigen::Matrix<Scalar, 3, 9>> calc_S2_dS2(TRefIn a_in)
+  {
+    const Scalar th2 = a_in.squaredNorm();
+    const auto t     = detail::trig_tails<Scalar>(th2);
+    const auto dt    = detail::trig_tails_dx2<Scalar>(th2, t);
+
+    Eigen::Matrix3<Scalar> M, E;
+    hat(a_in, M);
+    const Eigen::Matrix3<Scalar> MM = M * M;
+
+    const Eigen::Matrix3<Scalar> S2 = Eigen::Matrix3<Scalar>::Identity() / Scalar(2) - t.s3 * M + t.c4 * MM;
+
+    Eigen::Matrix<Scalar, 3, 9> dS2;
+    for (auto l = 0u; l < 3; ++l) {
+      hat(Eigen::Vector3<Scalar>::Unit(l), E);
+      const Eigen::Matrix3<Scalar> D =
+        Scalar(2) * a_in(l) * (-dt.s3 * M + dt.c4 * MM) - t.s3 * E + t.c4 * (E * M + M * E);
+      for (auto i = 0u; i < 3; ++i) { dS2.col(3 * i + l) = D.row(i).transpose(); }
+    }
+
+    return {S2, dS2};
+  }
+
   /**
    * @brief Compute matrix inverse of sum
    * \f[
@@ -79,6 +106,9 @@ public:
     const Scalar th2 = a_in.squaredNorm();
 
     const auto A = [&]() -> Scalar {
+      if constexpr (detail::use_fast_math<Scalar>) {
+        if (th2 <= detail::fast::max_x2<Scalar>) { return detail::fast::dexpinv<Scalar>(th2); }
+      }
       if (th2 < Scalar(eps2)) {
         // https://www.wolframalpha.com/input/?i=series+1%2Fx%5E2-%281%2Bcos+x%29%2F%282*x*sin+x%29+at+x%3D0
         return Scalar(1) / Scalar(12) + th2 / Scalar(720);
@@ -127,6 +157,9 @@ public:
     const Scalar xyz2 = g_in[0] * g_in[0] + g_in[1] * g_in[1] + g_in[2] * g_in[2];
 
     const auto phi = [&]() -> Scalar {
+      if constexpr (detail::use_fast_math<Scalar>) {
+        if (g_in[3] >= Scalar(0)) { return detail::fast::log_scale<Scalar>(xyz2, g_in[3]); }
+      }
       if (xyz2 < Scalar(eps2)) {
         // https://www.wolframalpha.com/input/?i=series+atan%28y%2Fx%29+%2F+y+at+y%3D0
         return Scalar(2) / g_in[3] - Scalar(2) * xyz2 / (Scalar(3) * g_in[3] * g_in[3] * g_in[3]);
@@ -153,6 +186,11 @@ public:
     const Scalar th2 = a_in.squaredNorm();
 
     const auto [A, B] = [&]() -> std::array<Scalar, 2> {
+      if constexpr (detail::use_fast_math<Scalar>) {
+        if (th2 <= detail::fast::max_x2<Scalar>) {
+          return {detail::fast::sinc_half<Scalar>(th2), detail::fast::cos_half<Scalar>(th2)};
+        }
+      }
       if (th2 < Scalar(eps2)) {
         return {
           // https://www.wolframalpha.com/input/?i=series+sin%28x%2F2%29%2Fx+at+x%3D0
@@ -195,6 +233,116 @@ public:
     A_out.noalias() = calc_S1inv(a_in) + ad_a;
   }
 
+  /**
+   * @brief Fused exp and dr_exp.
+   *
+   * @return Taylor tails of the rotation angle for re-use in semi-direct products.
+   */
+  static detail::TrigTails<Scalar> exp_dr_exp(TRefIn a_in, GRefOut g_out, TMapRefOut A_out)
+  {
+    using std::sqrt, std::cos, std::sin;
+
+    const Scalar th2 = a_in.squaredNorm();
+
+    const auto [A, B, tails] = [&]() -> std::tuple<Scalar, Scalar, detail::TrigTails<Scalar>> {
+      if constexpr (detail::use_fast_math<Scalar>) {
+        if (th2 <= detail::fast::max_x2<Scalar>) {
+          return {
+            detail::fast::sinc_half<Scalar>(th2),
+            detail::fast::cos_half<Scalar>(th2),
+            detail::trig_tails<Scalar>(th2),
+          };
+        }
+      }
+      if (th2 < Scalar(eps2)) {
+        return {
+          Scalar(1) / Scalar(2) - th2 / Scalar(48),
+          Scalar(1) - th2 / Scalar(8),
+          detail::trig_tails<Scalar>(th2),
+        };
+      } else {
+        const Scalar th = sqrt(th2);
+        const Scalar sh = sin(th / Scalar(2));
+        const Scalar ch = cos(th / Scalar(2));
+        return {sh / th, ch, detail::trig_tails<Scalar>(th2, sh, ch)};
+      }
+    }();
+
+    g_out << A * a_in.x(), A * a_in.y(), A * a_in.z(), B;
+    if (g_out[3] < Scalar(0)) { g_out *= Scalar(-1); }
+
+    Eigen::Matrix3<Scalar> M;
+    hat(a_in, M);
+    A_out.noalias() = Eigen::Matrix3<Scalar>::Identity() + tails.c2 * M - tails.s3 * M * M;
+
+    return tails;
+  }
+
+  /**
+   * @brief Fused log and dr_expinv.
+   *
+   * The half-angle sine and cosine are read off the quaternion, so no trigonometric functions
+   * besides the atan2 in the log are evaluated.
+   *
+   * @return Taylor tails of the rotation angle for re-use in semi-direct products.
+   */
+  static detail::TrigTails<Scalar> log_dr_expinv(GRefIn g_in, TRefOut a_out, TMapRefOut A_out)
+  {
+    using std::sqrt;
+
+    log(g_in, a_out);
+
+    const Scalar xyz2 = g_in[0] * g_in[0] + g_in[1] * g_in[1] + g_in[2] * g_in[2];
+    const Scalar th2  = a_out.squaredNorm();
+
+    const auto [A, tails] = [&]() -> std::tuple<Scalar, detail::TrigTails<Scalar>> {
+      if constexpr (detail::use_fast_math<Scalar>) {
+        if (th2 <= detail::fast::max_x2<Scalar>) {
+          return {detail::fast::dexpinv<Scalar>(th2), detail::trig_tails<Scalar>(th2)};
+        }
+      }
+      if (th2 < Scalar(eps2)) {
+        return {Scalar(1) / Scalar(12) + th2 / Scalar(720), detail::trig_tails<Scalar>(th2)};
+      } else {
+        // (1 + cos th) / sin th = cot(th / 2) = qw / |qxyz|
+        const Scalar th  = sqrt(th2);
+        const Scalar xyz = sqrt(xyz2);
+        const Scalar n   = sqrt(xyz2 + g_in[3] * g_in[3]);
+        return {
+          Scalar(1) / th2 - g_in[3] / (Scalar(2) * th * xyz),
+          detail::trig_tails<Scalar>(th2, xyz / n, g_in[3] / n),
+        };
+      }
+    }();
+
+    Eigen::Matrix3<Scalar> M;
+    hat(a_out, M);
+    A_out.noalias() = Eigen::Matrix3<Scalar>::Identity() + M / Scalar(2) + A * M * M;
+
+    return tails;
+  }
+
+  /**
+   * @brief Fused between-residual rminus(g1^-1 * g2, z) and its jacobians w.r.t. g1 and g2.
+   */
+  static void between_rminus(
+    GRefIn g_in1, GRefIn g_in2, GRefIn z_in, TRefOut a_out, TMapRefOut J1_out, TMapRefOut J2_out)
+  {
+    Eigen::Map<const Eigen::Quaternion<Scalar>> q1(g_in1.data());
+    Eigen::Map<const Eigen::Quaternion<Scalar>> q2(g_in2.data());
+    Eigen::Map<const Eigen::Quaternion<Scalar>> qz(z_in.data());
+
+    const Eigen::Quaternion<Scalar> qd = q1.conjugate() * q2;
+
+    Eigen::Vector4<Scalar> e = (qz.conjugate() * qd).coeffs();
+    if (e[3] < Scalar(0)) { e *= Scalar(-1); }
+
+    log_dr_expinv(e, a_out, J2_out);
+
+    // Ad_{(g1^-1 g2)^-1} = R_d^T
+    J1_out.noalias() = -J2_out * qd.toRotationMatrix().transpose();
+  }
+
   static void d2r_exp(TRefIn a_in, THessRefOut H_out)
   {
     const auto [A, B, dA_over_th, dB_over_th] = [&]() -> std::array<Scalar, 4> {
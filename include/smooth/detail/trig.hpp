@@ -12,6 +12,7 @@
 #include <cmath>
 
 #include "common.hpp"
+#include "fast_math.hpp"
 
 SMOOTH_BEGIN_NAMESPACE
 
@@ -19,6 +20,10 @@ namespace detail {
 template<typename S>
 S cos_2(const S & x2)
 {
+  if constexpr (use_fast_math<S>) {
+    if (x2 <= fast::max_x2<S>) { return fast::cos_2<S>(x2); }
+  }
+
   using std::cos, std::sqrt;
 
   if (x2 > S(eps2)) {
@@ -32,6 +37,10 @@ S cos_2(const S & x2)
 template<typename S>
 S sin_3(const S & x2)
 {
+  if constexpr (use_fast_math<S>) {
+    if (x2 <= fast::max_x2<S>) { return fast::sin_3<S>(x2); }
+  }
+
   using std::sin, std::sqrt;
 
   if (x2 > S(eps2)) {
@@ -45,6 +54,10 @@ S sin_3(const S & x2)
 template<typename S>
 S cos_4(const S & x2)
 {
+  if constexpr (use_fast_math<S>) {
+    if (x2 <= fast::max_x2<S>) { return fast::cos_4<S>(x2); }
+  }
+
   using std::cos, std::sqrt;
 
   if (x2 > S(eps2)) {
@@ -58,6 +71,10 @@ S cos_4(const S & x2)
 template<typename S>
 S sin_5(const S & x2)
 {
+  if constexpr (use_fast_math<S>) {
+    if (x2 <= fast::max_x2<S>) { return fast::sin_5<S>(x2); }
+  }
+
   using std::sin, std::sqrt;
 
   if (x2 > S(eps2)) {
@@ -71,6 +88,10 @@ S sin_5(const S & x2)
 template<typename S>
 S cos_6(const S & x2)
 {
+  if constexpr (use_fast_math<S>) {
+    if (x2 <= fast::max_x2<S>) { return fast::cos_6<S>(x2); }
+  }
+
   using std::cos, std::sqrt;
 
   const S x4 = x2 * x2;
@@ -82,6 +103,104 @@ S cos_6(const S & x2)
   }
 }
 
+/**
+ * @brief Taylor tails cos_2, sin_3, cos_4, sin_5, cos_6 evaluated together.
+ */
+template<typename S>
+struct TrigTails
+{
+  S c2, s3, c4, s5, c6;
+};
+
+/**
+ * @brief Evaluate all Taylor tails from precomputed half-angle trigonometric values.
+ *
+ * @param x2 squared argument
+ * @param sh sin(x / 2) (only used if x2 > eps2)
+ * @param ch cos(x / 2) (only used if x2 > eps2)
+ *
+ * Uses sin x = 2 sh ch and cos x - 1 = -2 sh^2, which avoids further transcendental function calls
+ * when the half-angle values are already available (e.g. from a unit quaternion).
+ */
+template<typename S>
+TrigTails<S> trig_tails(const S & x2, const S & sh, const S & ch)
+{
+  using std::sqrt;
+
+  const S x4 = x2 * x2;
+  if (x2 > S(eps2)) {
+    const S x   = sqrt(x2);
+    const S s   = S(2) * sh * ch;
+    const S cm1 = -S(2) * sh * sh;
+    return {
+      cm1 / x2,
+      (s - x) / (x2 * x),
+      (cm1 + x2 / S(2)) / x4,
+      (s - x + x2 * x / S(6)) / (x4 * x),
+      (cm1 + x2 / S(2) - x4 / S(24)) / (x4 * x2),
+    };
+  } else {
+    return {
+      -S(1) / S(2) + x2 / S(24) - x4 / S(720),
+      -S(1) / S(6) + x2 / S(120) - x4 / S(5040),
+      S(1) / S(24) - x2 / S(720) + x4 / S(40320),
+      S(1) / S(120) - x2 / S(5040) + x4 / S(362880),
+      -S(1) / S(720) + x2 / S(40320) - x4 / S(3628800),
+    };
+  }
+}
+
+/**
+ * @brief Evaluate all Taylor tails with a single sin / cos evaluation.
+ */
+template<typename S>
+TrigTails<S> trig_tails(const S & x2)
+{
+  using std::cos, std::sin, std::sqrt;
+
+  if constexpr (use_fast_math<S>) {
+    if (x2 <= fast::max_x2<S>) {
+      return {fast::cos_2<S>(x2), fast::sin_3<S>(x2), fast::cos_4<S>(x2), fast::sin_5<S>(x2), fast::cos_6<S>(x2)};
+    }
+  }
+
+  if (x2 > S(eps2)) {
+    const S x = sqrt(x2);
+    return trig_tails<S>(x2, sin(x / S(2)), cos(x / S(2)));
+  } else {
+    return trig_tails<S>(x2, S(0), S(1));
+  }
+}
+
+/**
+ * @brief Derivatives of the Taylor tails w.r.t. the squared argument x2.
+ *
+ * @param x2 squared argument
+ * @param t tails evaluated at x2
+ */
+template<typename S>
+TrigTails<S> trig_tails_dx2(const S & x2, const TrigTails<S> & t)
+{
+  if (x2 > S(eps2)) {
+    const S x2_2 = S(2) * x2;
+    return {
+      -(S(1) + x2 * t.s3 + S(2) * t.c2) / x2_2,
+      (t.c2 - S(3) * t.s3) / x2_2,
+      -(t.s3 + S(4) * t.c4) / x2_2,
+      (t.c4 - S(5) * t.s5) / x2_2,
+      -(t.s5 + S(6) * t.c6) / x2_2,
+    };
+  } else {
+    return {
+      S(1) / S(24) - x2 / S(360),
+      S(1) / S(120) - x2 / S(2520),
+      -S(1) / S(720) + x2 / S(20160),
+      -S(1) / S(5040) + x2 / S(181440),
+      S(1) / S(40320) - x2 / S(1814400),
+    };
+  }
+}
+
 }  // namespace detail
 
 SMOOTH_END_NAMESPACE
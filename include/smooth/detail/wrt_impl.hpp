@@ -72,6 +72,50 @@ auto wrt_rplus(auto && wrt, const Eigen::MatrixBase<Derived> & a)
   return f(std::make_index_sequence<std::tuple_size_v<Wrt>>{});
 }
 
+/**
+ * @brief Calculate x_i <- rplus(x_i, a[bi: bi + ni]) in-place for a tuple of modifiable variables
+ */
+template<typename Derived>
+void wrt_rplus_assign(auto && wrt, const Eigen::MatrixBase<Derived> & a)
+{
+  using Wrt = std::decay_t<decltype(wrt)>;
+
+  Eigen::Index I0 = 0;
+  utils::static_for<std::tuple_size_v<Wrt>>([&](auto i) {
+    auto & w        = std::get<i>(wrt);
+    using W         = std::decay_t<decltype(w)>;
+    const auto nx_i = dof<W>(w);
+    rplus_assign(w, a.template segment<Dof<W>>(I0, nx_i));
+    I0 += nx_i;
+  });
+}
+
+/**
+ * @brief Calculate x_i <- rplus(x_i, a[bi: bi + ni]) in-place with execution options
+ *
+ * The execution options (e.g. ManifoldVectorOptions) are passed to the variables whose
+ * traits::man<>::rplus_assign accepts them, the other variables are updated as in wrt_rplus_assign().
+ */
+template<typename Derived, typename Exec>
+void wrt_rplus_assign(auto && wrt, const Eigen::MatrixBase<Derived> & a, const Exec & exec)
+{
+  using Wrt = std::decay_t<decltype(wrt)>;
+
+  Eigen::Index I0 = 0;
+  utils::static_for<std::tuple_size_v<Wrt>>([&](auto i) {
+    auto & w        = std::get<i>(wrt);
+    using W         = std::decay_t<decltype(w)>;
+    const auto nx_i = dof<W>(w);
+    const auto a_i  = a.template segment<Dof<W>>(I0, nx_i);
+    if constexpr (requires(W & w_, const Exec & e_) { traits::man<W>::rplus_assign(w_, a_i, e_); }) {
+      traits::man<W>::rplus_assign(w, a_i, exec);
+    } else {
+      rplus_assign(w, a_i);
+    }
+    I0 += nx_i;
+  });
+}
+
 // \cond
 namespace detail {
 
@@ -94,6 +94,69 @@ auto dr(auto && f, auto && x);
 template<std::size_t K, std::size_t... Idx>
 auto dr(auto && f, auto && x, std::index_sequence<Idx...> idx);
 
+/**
+ * @brief Hessian-vector product in tangent space.
+ *
+ * Computes the product between the second derivative of f and a tangent direction v without
+ * forming the full Hessian. The result is returned as a matrix Hv s.t.
+ * Hv(j, i) = sum_k d2fi / dxjxk * vk, i.e. column i is the product between the Hessian of the i:th
+ * degree of freedom of f and v.
+ *
+ * @tparam D differentiation method to use
+ *
+ * @param f function to differentiate
+ * @param x reference tuple of function arguments
+ * @param v direction (must be of size dof(x))
+ * @return {f(x), dr f(x), d2r f(x) * v}
+ *
+ * @note Numerical and Autodiff require O(dof(x)) evaluations of f, as opposed to O(dof(x)^2)
+ * evaluations for the full Hessian.
+ */
+template<Type D>
+auto dr_hvp(auto && f, auto && x, const auto & v);
+
+/**
+ * @brief Hessian-vector product in tangent space using default method.
+ *
+ * @param f function to differentiate
+ * @param x reference tuple of function arguments
+ * @param v direction (must be of size dof(x))
+ */
+auto dr_hvp(auto && f, auto && x, const auto & v);
+
+/**
+ * @brief Block-diagonal Hessian approximation in tangent space.
+ *
+ * Computes the diagonal blocks of size B x B of the second derivative and ignores all entries
+ * outside of them. Blocks are stored as a vertically stacked matrix, and outputs are stacked
+ * horizontally as for the full Hessian, i.e.
+ * Hb(j, i * B + k) = d2fi / dxj dx(B * (j / B) + k).
+ *
+ * @tparam B block size (B = 1 computes the Hessian diagonal)
+ * @tparam D differentiation method to use
+ *
+ * @param f function to differentiate
+ * @param x reference tuple of function arguments
+ * @return {f(x), dr f(x), Hb}
+ *
+ * @note Numerical and Autodiff require O(B * dof(x)) evaluations of f.
+ */
+template<std::size_t B, Type D>
+  requires(B >= 1)
+auto dr_hessian_blockdiag(auto && f, auto && x);
+
+/**
+ * @brief Block-diagonal Hessian approximation in tangent space using default method.
+ *
+ * @tparam B block size (B = 1 computes the Hessian diagonal)
+ *
+ * @param f function to differentiate
+ * @param x reference tuple of function arguments
+ */
+template<std::size_t B>
+  requires(B >= 1)
+auto dr_hessian_blockdiag(auto && f, auto && x);
+
 }  // namespace diff
 
 SMOOTH_END_NAMESPACE
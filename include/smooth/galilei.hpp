@@ -172,6 +172,48 @@ public:
 
     return ret;
   }
+
+  /**
+   * @brief Galilean action on a batch of space-time vectors.
+   *
+   * The rotation matrix is computed once and applied to all columns.
+   *
+   * @param V 4 x N matrix of vectors (x, t)
+   * @return 4 x N matrix with columns \f$ X v_i \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 4, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    Eigen::Matrix<Scalar, 4, EigenDerived::ColsAtCompileTime> ret(4, V.cols());
+    ret.template topRows<3>().noalias() = so3().matrix() * V.template topRows<3>() + r3_v() * V.row(3);
+    ret.template topRows<3>().colwise() += r3_p();
+
+    ret.row(3) = V.row(3).array() + r1_t().x();
+    return ret;
+  }
+
+  /**
+   * @brief Jacobians of Galilean action on a batch of space-time vectors w.r.t. group.
+   *
+   * @param V 4 x N matrix of vectors (x, t)
+   * @return 4 x 10N matrix with horizontally stacked blocks \f$ \mathrm{d}^r (X v_i)_X \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 4, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    const Eigen::Matrix3<Scalar> R = so3().matrix();
+
+    Eigen::Matrix<Scalar, 4, -1> ret = Eigen::Matrix<Scalar, 4, -1>::Zero(4, 10 * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      ret.template block<3, 3>(0, 10 * i)               = V(3, i) * R;
+      ret.template block<3, 3>(0, 10 * i + 3)           = R;
+      ret.template block<3, 1>(0, 10 * i + 6)           = r3_v();
+      ret.template block<3, 3>(0, 10 * i + 7).noalias() = -R * SO3<Scalar>::hat(V.template block<3, 1>(0, i));
+      ret(3, 10 * i + 6)                                = Scalar(1);
+    }
+    return ret;
+  }
 };
 
 // \cond
@@ -0,0 +1,200 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+/**
+ * @file
+ * @brief Structure-of-arrays container for Lie group elements.
+ */
+
+#include <cassert>
+#include <ranges>
+
+#include <Eigen/Core>
+
+#include "detail/lie_array_impl.hpp"
+#include "lie_group_base.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief Structure-of-arrays container for a batch of Lie group elements.
+ *
+ * Elements are stored in a row-major RepSize x N matrix where each coefficient of the group is a
+ * contiguous row. Batched operations are implemented in LieArrayImpl and process entire rows at a
+ * time which allows vectorization across elements (currently specialized for SO3 and SE3, other
+ * groups use element-wise fallbacks).
+ *
+ * Contiguous arrays of group elements (such as a std::vector<G> or a buffer of Map<G> elements)
+ * are stored as a column-major RepSize x N matrix, and conversion between the two layouts is
+ * a matrix assignment.
+ *
+ * @tparam G native Lie group type (e.g. SO3d or SE3d).
+ *
+ * Example:
+ * @code
+ * std::vector<SE3d> poses = ...;
+ * LieArray<SE3d> arr(poses);
+ * const auto logs = arr.log();  // 6 x N row-major
+ * @endcode
+ */
+template<typename G>
+  requires(liebase_info<G>::Impl::RepSize > 0)
+class LieArray
+{
+  using Impl = typename liebase_info<G>::Impl;
+
+public:
+  /// @brief Scalar type.
+  using Scalar = typename liebase_info<G>::Scalar;
+  /// @brief Group type.
+  using Group = typename liebase_info<G>::template PlainObject<Scalar>;
+
+  /// @brief Group representation size.
+  static constexpr int RepSize = Impl::RepSize;
+  /// @brief Group degrees of freedom.
+  static constexpr int Dof = Impl::Dof;
+
+  /// @brief Storage of group elements (one row per coefficient).
+  using Storage = Eigen::Matrix<Scalar, RepSize, -1, Eigen::RowMajor>;
+  /// @brief Storage of tangent elements (one row per degree of freedom).
+  using TangentArray = Eigen::Matrix<Scalar, Dof, -1, Eigen::RowMajor>;
+  /// @brief Storage of vectors that the group acts on (one row per coordinate).
+  template<int N>
+  using VectorArray = Eigen::Matrix<Scalar, N, -1, Eigen::RowMajor>;
+
+  /// @brief Default constructor creates an empty array.
+  LieArray() = default;
+
+  /// @brief Construct array of size n with uninitialized elements.
+  explicit LieArray(const Eigen::Index n) : m_coeffs(RepSize, n) {}
+
+  /**
+   * @brief Construct from coefficient matrix.
+   *
+   * @param coeffs matrix of size RepSize x N where column i contains the coefficients of element i.
+   *
+   * @note A contiguous buffer of N elements can be converted with
+   * Eigen::Map<const Eigen::Matrix<Scalar, RepSize, -1>>(data, RepSize, N).
+   */
+  template<typename Derived>
+  explicit LieArray(const Eigen::MatrixBase<Derived> & coeffs) : m_coeffs(coeffs)
+  {}
+
+  /**
+   * @brief Construct from range of group elements (e.g. std::vector<G> or a range of Map<G>).
+   */
+  template<std::ranges::sized_range R, typename T = std::decay_t<std::ranges::range_value_t<R>>>
+    requires(std::is_base_of_v<LieGroupBase<T>, T>)
+  explicit LieArray(R && r) : m_coeffs(RepSize, static_cast<Eigen::Index>(std::ranges::size(r)))
+  {
+    Eigen::Index i = 0;
+    for (const auto & g : r) { m_coeffs.col(i++) = g.coeffs(); }
+  }
+
+  /// @brief Array of n identity elements.
+  static LieArray Identity(const Eigen::Index n)
+  {
+    LieArray ret(n);
+    for (Eigen::Index i = 0; i < n; ++i) { ret.m_coeffs.col(i) = Group::Identity().coeffs(); }
+    return ret;
+  }
+
+  /// @brief Array of n random elements.
+  static LieArray Random(const Eigen::Index n)
+  {
+    LieArray ret(n);
+    for (Eigen::Index i = 0; i < n; ++i) { ret.m_coeffs.col(i) = Group::Random().coeffs(); }
+    return ret;
+  }
+
+  /// @brief Number of elements.
+  Eigen::Index size() const { return m_coeffs.cols(); }
+
+  /// @brief Resize array (existing elements are kept).
+  void resize(const Eigen::Index n) { m_coeffs.conservativeResize(RepSize, n); }
+
+  /// @brief Access coefficient storage.
+  Storage & coeffs() { return m_coeffs; }
+
+  /// @brief Const access coefficient storage.
+  const Storage & coeffs() const { return m_coeffs; }
+
+  /// @brief Copy out element i.
+  Group operator[](const Eigen::Index i) const
+  {
+    Group ret;
+    ret.coeffs() = m_coeffs.col(i);
+    return ret;
+  }
+
+  /// @brief Set element i.
+  template<typename Derived>
+  void set(const Eigen::Index i, const LieGroupBase<Derived> & g)
+  {
+    m_coeffs.col(i) = g.coeffs();
+  }
+
+  /**
+   * @brief Write elements to a contiguous buffer.
+   *
+   * After the call element i can be accessed as Map<G>(data + i * RepSize).
+   *
+   * @param data buffer of size at least RepSize * size().
+   */
+  void copy_to(Scalar * data) const
+  {
+    Eigen::Map<Eigen::Matrix<Scalar, RepSize, -1>>(data, RepSize, size()) = m_coeffs;
+  }
+
+  /// @brief Element-wise group composition.
+  LieArray operator*(const LieArray & o) const
+  {
+    assert(size() == o.size());
+    return LieArray(LieArrayImpl<Impl>::composition(m_coeffs, o.m_coeffs), 0);
+  }
+
+  /// @brief Element-wise group inverse.
+  LieArray inverse() const { return LieArray(LieArrayImpl<Impl>::inverse(m_coeffs), 0); }
+
+  /// @brief Element-wise group logarithm (returns Dof x N row-major matrix).
+  TangentArray log() const { return LieArrayImpl<Impl>::log(m_coeffs); }
+
+  /// @brief Element-wise group exponential of a Dof x N matrix of tangent elements.
+  template<typename Derived>
+  static LieArray exp(const Eigen::MatrixBase<Derived> & a)
+  {
+    return LieArray(LieArrayImpl<Impl>::exp(TangentArray(a)), 0);
+  }
+
+  /// @brief Element-wise right-plus: this * exp(a).
+  template<typename Derived>
+  LieArray operator+(const Eigen::MatrixBase<Derived> & a) const
+  {
+    return *this * exp(a);
+  }
+
+  /// @brief Element-wise right-minus: log(o^{-1} * this).
+  TangentArray operator-(const LieArray & o) const { return (o.inverse() * *this).log(); }
+
+  /**
+   * @brief Element-wise group action.
+   *
+   * @param v N x size() matrix where column i is acted upon by element i.
+   */
+  template<typename Derived>
+  VectorArray<Derived::RowsAtCompileTime> act(const Eigen::MatrixBase<Derived> & v) const
+  {
+    static constexpr int N = Derived::RowsAtCompileTime;
+    assert(v.cols() == size());
+    return LieArrayImpl<Impl>::template act<N>(m_coeffs, VectorArray<N>(v));
+  }
+
+private:
+  // move-construct from storage
+  LieArray(Storage && coeffs, int) : m_coeffs(std::move(coeffs)) {}
+
+  Storage m_coeffs;
+};
+
+SMOOTH_END_NAMESPACE
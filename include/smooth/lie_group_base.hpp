@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <tuple>
+#include <utility>
+
 #include <Eigen/Core>
 
 #include "smooth/version.hpp"
@@ -235,6 +238,28 @@ public:
     }
   }
 
+  /**
+   * @brief Covariance transport with the group adjoint.
+   *
+   * Uses the block structure of \f$ \mathbf{Ad_X} \f$ when the group provides a kernel.
+   *
+   * @return \f$ \mathbf{Ad_X} P \mathbf{Ad_X}^T \f$
+   */
+  template<typename PDerived>
+  TangentMap Ad_cov(const Eigen::MatrixBase<PDerived> & P) const noexcept
+  {
+    TangentMap ret;
+    if constexpr (IsCommutative) {
+      ret = P;
+    } else if constexpr (requires { Impl::Ad_cov(cderived().coeffs(), P, ret); }) {
+      Impl::Ad_cov(cderived().coeffs(), P, ret);
+    } else {
+      const TangentMap A = Ad();
+      ret.noalias()      = A * P * A.transpose();
+    }
+    return ret;
+  }
+
   /**
    * @brief Right-plus.
    *
@@ -375,6 +400,29 @@ public:
     }
   }
 
+  /**
+   * @brief Covariance transport with the right jacobian of the exponential map.
+   *
+   * Uses the block structure of \f$ \mathrm{d}^r \exp_a \f$ when the group provides a kernel.
+   *
+   * @return \f$ \mathrm{d}^r \exp_a P \left( \mathrm{d}^r \exp_a \right)^T \f$
+   */
+  template<typename TangentDerived, typename PDerived>
+  static TangentMap
+  dr_exp_cov(const Eigen::MatrixBase<TangentDerived> & a, const Eigen::MatrixBase<PDerived> & P) noexcept
+  {
+    TangentMap ret;
+    if constexpr (IsCommutative) {
+      ret = P;
+    } else if constexpr (requires { Impl::dr_exp_cov(a, P, ret); }) {
+      Impl::dr_exp_cov(a, P, ret);
+    } else {
+      const TangentMap J = dr_exp(a);
+      ret.noalias()      = J * P * J.transpose();
+    }
+    return ret;
+  }
+
   /**
    * @brief Inverse of right jacobian of the exponential map.
    *
@@ -392,6 +440,82 @@ public:
     }
   }
 
+  /**
+   * @brief Lie group exponential map and its right jacobian.
+   *
+   * Equivalent to {exp(a), dr_exp(a)} but evaluates shared (trigonometric) terms only once.
+   *
+   * @return pair \f$ \left( \exp(a), \mathrm{d}^r \exp_a \right) \f$
+   */
+  template<typename TangentDerived>
+  static std::pair<PlainObject, TangentMap> exp_with_dr_exp(const Eigen::MatrixBase<TangentDerived> & a) noexcept
+  {
+    std::pair<PlainObject, TangentMap> ret;
+    if constexpr (IsCommutative) {
+      Impl::exp(a, ret.first.coeffs());
+      ret.second.setIdentity();
+    } else {
+      Impl::exp_dr_exp(a, ret.first.coeffs(), ret.second);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief Lie group logarithm and inverse of right jacobian of the exponential map at the logarithm.
+   *
+   * Equivalent to {log(), dr_expinv(log())} but evaluates shared (trigonometric) terms only once.
+   *
+   * @return pair \f$ \left( a, \left( \mathrm{d}^r \exp_a \right)^{-1} \right) \f$ where \f$ a = \log(x) \f$
+   */
+  [[nodiscard]] std::pair<Tangent, TangentMap> log_with_dr_expinv() const noexcept
+  {
+    std::pair<Tangent, TangentMap> ret;
+    if constexpr (IsCommutative) {
+      Impl::log(cderived().coeffs(), ret.first);
+      ret.second.setIdentity();
+    } else {
+      Impl::log_dr_expinv(cderived().coeffs(), ret.first, ret.second);
+    }
+    return ret;
+  }
+
+  /**
+   * @brief Between-residual and its right jacobians.
+   *
+   * Computes \f$ r = (g_1^{-1} g_2) \ominus_r z \f$ together with \f$ \mathrm{d}^r r_{g_1} \f$ and
+   * \f$ \mathrm{d}^r r_{g_2} \f$. Groups that provide a fused kernel share rotation matrices and
+   * trigonometric terms between the residual and the jacobians.
+   *
+   * @return tuple \f$ \left( r, \mathrm{d}^r r_{g_1}, \mathrm{d}^r r_{g_2} \right) \f$
+   */
+  template<typename Derived1, typename Derived2, typename Derived3>
+  static std::tuple<Tangent, TangentMap, TangentMap> between_rminus(
+    const LieGroupBase<Derived1> & g1, const LieGroupBase<Derived2> & g2, const LieGroupBase<Derived3> & z) noexcept
+  {
+    const auto & g1c = static_cast<const Derived1 &>(g1).coeffs();
+    const auto & g2c = static_cast<const Derived2 &>(g2).coeffs();
+    const auto & zc  = static_cast<const Derived3 &>(z).coeffs();
+
+    std::tuple<Tangent, TangentMap, TangentMap> ret;
+    Tangent & r     = std::get<0>(ret);
+    TangentMap & J1 = std::get<1>(ret);
+    TangentMap & J2 = std::get<2>(ret);
+
+    if constexpr (requires { Impl::between_rminus(g1c, g2c, zc, r, J1, J2); }) {
+      Impl::between_rminus(g1c, g2c, zc, r, J1, J2);
+    } else {
+      PlainObject g1inv, d, zinv, e;
+      Impl::inverse(g1c, g1inv.coeffs());
+      Impl::composition(g1inv.coeffs(), g2c, d.coeffs());
+      Impl::inverse(zc, zinv.coeffs());
+      Impl::composition(zinv.coeffs(), d.coeffs(), e.coeffs());
+
+      std::tie(r, J2) = e.log_with_dr_expinv();
+      J1.noalias()    = -J2 * d.inverse().Ad();
+    }
+    return ret;
+  }
+
   /**
    * @brief Left jacobian of the exponential map.
    *
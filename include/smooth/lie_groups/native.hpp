@@ -88,6 +88,11 @@ struct lie<G>
     }
   }
   static inline typename G::TangentMap Ad(const G & g) { return g.Ad(); }
+  template<typename Derived>
+  static inline typename G::TangentMap Ad_cov(const G & g, const Eigen::MatrixBase<Derived> & P)
+  {
+    return g.Ad_cov(P);
+  }
   template<NativeLieGroup Go>
   static inline PlainObject composition(const G & g1, const Go & g2)
   {
@@ -101,6 +106,15 @@ struct lie<G>
     return g.isApprox(go, eps);
   }
   static inline typename G::Tangent log(const G & g) { return g.log(); }
+  static inline std::pair<typename G::Tangent, typename G::TangentMap> log_with_dr_expinv(const G & g)
+  {
+    return g.log_with_dr_expinv();
+  }
+  static inline std::tuple<typename G::Tangent, typename G::TangentMap, typename G::TangentMap>
+  between_rminus(const G & g1, const G & g2, const G & z)
+  {
+    return G::between_rminus(g1, g2, z);
+  }
   template<typename NewScalar>
   static inline CastT<NewScalar> cast(const G & g)
   {
@@ -120,11 +134,27 @@ struct lie<G>
     return G::exp(a);
   }
   template<typename Derived>
+  static inline void rplus_assign(G & g, const Eigen::MatrixBase<Derived> & a)
+  {
+    g += a;
+  }
+  template<typename Derived>
   static inline typename G::TangentMap dr_exp(const Eigen::MatrixBase<Derived> & a)
   {
     return G::dr_exp(a);
   }
   template<typename Derived>
+  static inline std::pair<PlainObject, typename G::TangentMap> exp_with_dr_exp(const Eigen::MatrixBase<Derived> & a)
+  {
+    return G::exp_with_dr_exp(a);
+  }
+  template<typename Derived1, typename Derived2>
+  static inline typename G::TangentMap
+  dr_exp_cov(const Eigen::MatrixBase<Derived1> & a, const Eigen::MatrixBase<Derived2> & P)
+  {
+    return G::dr_exp_cov(a, P);
+  }
+  template<typename Derived>
   static inline typename G::TangentMap dr_expinv(const Eigen::MatrixBase<Derived> & a)
   {
     return G::dr_expinv(a);
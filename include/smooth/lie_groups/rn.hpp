@@ -68,6 +68,11 @@ struct lie<G>
     return a;
   }
   template<typename Derived>
+  static inline void rplus_assign(G & g, const Eigen::MatrixBase<Derived> & a)
+  {
+    g += a;
+  }
+  template<typename Derived>
   static inline Eigen::Matrix<Scalar, Dof, Dof> dr_exp(const Eigen::MatrixBase<Derived> & a)
   {
     return Eigen::Matrix<Scalar, Dof, Dof>::Identity(a.size(), a.size());
@@ -68,6 +68,11 @@ struct lie<G>
     return a(0);
   }
   template<typename Derived>
+  static inline void rplus_assign(G & g, const Eigen::MatrixBase<Derived> & a)
+  {
+    g += a(0);
+  }
+  template<typename Derived>
   static inline Eigen::Matrix<Scalar, 1, 1> dr_exp(const Eigen::MatrixBase<Derived> &)
   {
     return Eigen::Matrix<Scalar, 1, 1>::Identity();
@@ -9,5 +9,6 @@
 
 #include "concepts/manifold.hpp"
 #include "lie_groups.hpp"
+#include "manifolds/pool.hpp"
 #include "manifolds/variant.hpp"
 #include "manifolds/vector.hpp"
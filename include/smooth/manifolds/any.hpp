@@ -2,7 +2,11 @@
 
 #pragma once
 
-#include <memory>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 #include "smooth/concepts/manifold.hpp"
@@ -11,70 +15,115 @@ SMOOTH_BEGIN_NAMESPACE
 
 /**
  * @brief Type erasure Manifold class.
+ *
+ * Values whose wrapper fits in an inline buffer of BufferSize bytes (this includes all native Lie
+ * groups up to Galilei and SE_K_3<double, 3>) are stored without a heap allocation. Larger types
+ * are stored on the heap.
  */
 class AnyManifold
 {
 public:
+  /// @brief Size of the inline buffer in bytes.
+  static constexpr std::size_t BufferSize = 128;
+
+  /// @brief Alignment of the inline buffer in bytes.
+  static constexpr std::size_t BufferAlign =
+    std::max<std::size_t>(alignof(std::max_align_t), EIGEN_MAX_STATIC_ALIGN_BYTES);
+
   /// @brief Constructor.
   AnyManifold() { throw std::runtime_error("Can not default-construct"); }
 
   /// @brief Construct from typed manifoild
   template<typename M>
-  explicit AnyManifold(const M & m) : m_val(std::make_unique<wrapper<std::decay_t<M>>>(m))
-  {}
+  explicit AnyManifold(const M & m)
+  {
+    using W = wrapper<std::decay_t<M>>;
+    if constexpr (fits_inline<std::decay_t<M>>) {
+      m_val = new (m_buf) W(m);
+    } else {
+      m_val = new W(m);
+    }
+  }
 
   /// @brief Copy constructor.
-  AnyManifold(const AnyManifold & m) : m_val(m.m_val->clone()) {}
+  AnyManifold(const AnyManifold & m) : m_val(m.m_val->copy_to(m_buf)) {}
 
   /// @brief Move constructor.
-  AnyManifold(AnyManifold && m) : m_val(std::move(m.m_val)) {}
+  AnyManifold(AnyManifold && m) noexcept { steal(std::move(m)); }
 
   /// @brief Copy assignment.
   AnyManifold & operator=(const AnyManifold & m)
   {
-    m_val = m.m_val->clone();
+    if (this != &m) {
+      AnyManifold tmp(m);
+      reset();
+      steal(std::move(tmp));
+    }
     return *this;
   }
 
   /// @brief Move assignment.
-  AnyManifold & operator=(AnyManifold && m)
+  AnyManifold & operator=(AnyManifold && m) noexcept
   {
-    m_val = std::move(m.m_val);
+    if (this != &m) {
+      reset();
+      steal(std::move(m));
+    }
     return *this;
   }
 
+  /// @brief Destructor.
+  ~AnyManifold() { reset(); }
+
   /// @brief Get value (mutable).
   template<Manifold M>
   M & get()
   {
-    return static_cast<wrapper<M> *>(m_val.get())->get();
+    return static_cast<wrapper<M> *>(m_val)->get();
   }
 
   /// @brief Get value (const).
   template<Manifold M>
   const M & get() const
   {
-    return static_cast<const wrapper<M> *>(m_val.get())->get();
+    return static_cast<const wrapper<M> *>(m_val)->get();
   }
 
+  /// @brief True if the value is stored in the inline buffer.
+  bool is_inline() const { return m_val != nullptr && m_val->is_inline(); }
+
   /// @brief Degrees of freedom.
   Eigen::Index dof() const { return m_val->dof(); }
 
+  /// @brief In-place right-plus.
+  AnyManifold & rplus_inplace(Eigen::Ref<const Eigen::VectorXd> a)
+  {
+    m_val->rplus_inplace(a);
+    return *this;
+  }
+
   /// @brief Right-plus.
-  AnyManifold rplus(Eigen::Ref<const Eigen::VectorXd> a) const { return AnyManifold(m_val->rplus(a)); }
+  AnyManifold rplus(Eigen::Ref<const Eigen::VectorXd> a) const
+  {
+    AnyManifold ret(*this);
+    ret.rplus_inplace(a);
+    return ret;
+  }
 
   /// @brief Right-minus.
-  Eigen::VectorXd rminus(const AnyManifold & m2) const { return m_val->rminus(m2.m_val); }
+  Eigen::VectorXd rminus(const AnyManifold & m2) const { return m_val->rminus(*m2.m_val); }
 
 private:
   class wrapper_base
   {
   public:
-    virtual ~wrapper_base()                                                              = default;
-    virtual Eigen::Index dof() const                                                     = 0;
-    virtual std::unique_ptr<wrapper_base> rplus(Eigen::Ref<const Eigen::VectorXd>) const = 0;
-    virtual Eigen::VectorXd rminus(const std::unique_ptr<wrapper_base> & o) const        = 0;
-    virtual std::unique_ptr<wrapper_base> clone() const                                  = 0;
+    virtual ~wrapper_base()                                       = default;
+    virtual bool is_inline() const                                = 0;
+    virtual Eigen::Index dof() const                              = 0;
+    virtual void rplus_inplace(Eigen::Ref<const Eigen::VectorXd>) = 0;
+    virtual Eigen::VectorXd rminus(const wrapper_base & o) const  = 0;
+    virtual wrapper_base * copy_to(std::byte * buf) const         = 0;
+    virtual wrapper_base * move_to(std::byte * buf) noexcept      = 0;
   };
 
   template<Manifold M>
@@ -83,16 +132,29 @@ private:
   public:
     explicit wrapper(const M & val) : m_val(val) {}
     explicit wrapper(M && val) : m_val(std::move(val)) {}
+    bool is_inline() const override { return fits_inline<M>; }
     Eigen::Index dof() const override { return ::smooth::dof(m_val); }
-    std::unique_ptr<wrapper_base> rplus(Eigen::Ref<const Eigen::VectorXd> a) const override
+    void rplus_inplace(Eigen::Ref<const Eigen::VectorXd> a) override { m_val = ::smooth::rplus(m_val, a); }
+    Eigen::VectorXd rminus(const wrapper_base & o) const override
+    {
+      return ::smooth::rminus(m_val, static_cast<const wrapper<M> &>(o).m_val);
+    }
+    wrapper_base * copy_to(std::byte * buf) const override
     {
-      return std::make_unique<wrapper<M>>(::smooth::rplus(m_val, a));
+      if constexpr (fits_inline<M>) {
+        return new (buf) wrapper<M>(m_val);
+      } else {
+        return new wrapper<M>(m_val);
+      }
     }
-    Eigen::VectorXd rminus(const std::unique_ptr<wrapper_base> & o) const override
+    wrapper_base * move_to(std::byte * buf) noexcept override
     {
-      return ::smooth::rminus(m_val, static_cast<const wrapper<M> *>(o.get())->m_val);
+      if constexpr (fits_inline<M>) {
+        return new (buf) wrapper<M>(std::move(m_val));
+      } else {
+        return this;
+      }
     }
-    std::unique_ptr<wrapper_base> clone() const override { return std::make_unique<wrapper<M>>(m_val); }
     M & get() { return m_val; }
     const M & get() const { return m_val; }
 
@@ -100,9 +162,36 @@ private:
     M m_val;
   };
 
-private:
-  explicit AnyManifold(std::unique_ptr<wrapper_base> val) : m_val(std::move(val)) {}
-  std::unique_ptr<wrapper_base> m_val;
+  /// @brief True if wrapper<M> is stored in the inline buffer.
+  template<Manifold M>
+  static constexpr bool fits_inline = sizeof(wrapper<M>) <= BufferSize && alignof(wrapper<M>) <= BufferAlign
+                                   && std::is_nothrow_move_constructible_v<M>;
+
+  /// @brief Take over the value of m and leave m empty.
+  void steal(AnyManifold && m) noexcept
+  {
+    if (m.m_val != nullptr) {
+      m_val = m.m_val->move_to(m_buf);
+      if (m_val->is_inline()) { m.reset(); }
+      m.m_val = nullptr;
+    }
+  }
+
+  /// @brief Destroy the value.
+  void reset() noexcept
+  {
+    if (m_val != nullptr) {
+      if (m_val->is_inline()) {
+        m_val->~wrapper_base();
+      } else {
+        delete m_val;
+      }
+      m_val = nullptr;
+    }
+  }
+
+  alignas(BufferAlign) std::byte m_buf[BufferSize];
+  wrapper_base * m_val{nullptr};
 };
 
 namespace traits {
@@ -133,6 +222,12 @@ struct man<AnyManifold>
     return m.rplus(a);
   }
 
+  template<typename Derived>
+  static inline void rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    m.rplus_inplace(a);
+  }
+
   static inline Eigen::Vector<Scalar, Dof> rminus(const PlainObject & m1, const PlainObject & m2)
   {
     return m1.rminus(m2);
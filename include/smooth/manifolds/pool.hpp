@@ -0,0 +1,314 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+/**
+ * @file
+ * @brief Heterogeneous Manifold container with one contiguous array per element type.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "smooth/concepts/manifold.hpp"
+#include "smooth/detail/utils.hpp"
+#include "vector.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief Heterogeneous collection of Manifold elements that is itself a Manifold.
+ *
+ * Alternative to std::vector<std::variant<Ms...>> that stores the elements of each type Ms in a
+ * separate std::vector<Ms>, and keeps a map from insertion position to (type, index) pairs.
+ *
+ * The tangent space is partitioned by type: the tangent vector holds first the tangents of all
+ * elements of the first type (in the order they were inserted), then all tangents of the second
+ * type, and so on. Bulk operations (dof, rplus, rminus) therefore run one loop per type without
+ * any per-element dispatch; see tangent_offset() for the location of an element in the tangent.
+ * The loops are the std::vector<Manifold> kernels, and they take the same ManifoldVectorOptions.
+ *
+ * @tparam Ms distinct Manifold types with the same scalar type
+ */
+template<Manifold... Ms>
+  requires(sizeof...(Ms) > 0)
+class ManifoldPool
+{
+public:
+  /// @brief Scalar type of all element types.
+  using Scalar = typename traits::man<std::tuple_element_t<0, std::tuple<Ms...>>>::Scalar;
+
+  /// @brief Number of element types.
+  static constexpr std::size_t NumTypes = sizeof...(Ms);
+
+  /// @brief I:th element type.
+  template<std::size_t I>
+  using Type = std::tuple_element_t<I, std::tuple<Ms...>>;
+
+  /// @brief Index of element type M.
+  template<typename M>
+  static constexpr std::size_t TypeIndex = []<std::size_t... Is>(std::index_sequence<Is...>) {
+    return ((std::is_same_v<M, Ms> ? Is : 0) + ...);
+  }(std::make_index_sequence<NumTypes>{});
+
+  /// @brief Location of an element.
+  struct Slot
+  {
+    /// @brief element type index
+    std::size_t type;
+    /// @brief index in the array of that type
+    std::size_t index;
+  };
+
+  /**
+   * @brief Append an element.
+   *
+   * @return position of the element
+   */
+  template<typename M>
+    requires(std::is_same_v<std::decay_t<M>, Ms> || ...)
+  std::size_t push_back(M && m)
+  {
+    static constexpr std::size_t I = TypeIndex<std::decay_t<M>>;
+
+    auto & arr = std::get<I>(m_arrays);
+    m_slots.push_back(Slot{I, arr.size()});
+    arr.push_back(std::forward<M>(m));
+    return m_slots.size() - 1;
+  }
+
+  /// @brief Number of elements.
+  std::size_t size() const { return m_slots.size(); }
+
+  /// @brief True if there are no elements.
+  bool empty() const { return m_slots.empty(); }
+
+  /// @brief Location of the element at position pos.
+  const Slot & slot(std::size_t pos) const
+  {
+    assert(pos < m_slots.size());
+    return m_slots[pos];
+  }
+
+  /// @brief Contiguous array of all elements of type I.
+  template<std::size_t I>
+  std::vector<Type<I>> & array()
+  {
+    return std::get<I>(m_arrays);
+  }
+
+  /// @brief Contiguous array of all elements of type I.
+  template<std::size_t I>
+  const std::vector<Type<I>> & array() const
+  {
+    return std::get<I>(m_arrays);
+  }
+
+  /// @brief Access the element at position pos, which must have type M.
+  template<typename M>
+  M & get(std::size_t pos)
+  {
+    assert(slot(pos).type == TypeIndex<M>);
+    return std::get<TypeIndex<M>>(m_arrays)[m_slots[pos].index];
+  }
+
+  /// @brief Access the element at position pos, which must have type M.
+  template<typename M>
+  const M & get(std::size_t pos) const
+  {
+    assert(slot(pos).type == TypeIndex<M>);
+    return std::get<TypeIndex<M>>(m_arrays)[m_slots[pos].index];
+  }
+
+  /// @brief Call f(m) where m is the element at position pos.
+  template<typename F>
+  void visit(std::size_t pos, F && f)
+  {
+    const Slot & s = slot(pos);
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      static_cast<void>(((s.type == Is && (f(std::get<Is>(m_arrays)[s.index]), true)) || ...));
+    }(std::make_index_sequence<NumTypes>{});
+  }
+
+  /// @brief Call f(m) where m is the element at position pos.
+  template<typename F>
+  void visit(std::size_t pos, F && f) const
+  {
+    const Slot & s = slot(pos);
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      static_cast<void>(((s.type == Is && (f(std::get<Is>(m_arrays)[s.index]), true)) || ...));
+    }(std::make_index_sequence<NumTypes>{});
+  }
+
+  /// @brief Degrees of freedom.
+  Eigen::Index dof() const
+  {
+    Eigen::Index ret = 0;
+    utils::static_for<NumTypes>([&](auto I) { ret += traits::man<std::vector<Type<I>>>::dof(std::get<I>(m_arrays)); });
+    return ret;
+  }
+
+  /// @brief Offset of the element at position pos in the tangent vector.
+  Eigen::Index tangent_offset(std::size_t pos) const
+  {
+    const Slot & s = slot(pos);
+
+    Eigen::Index ret = 0;
+    utils::static_for<NumTypes>([&](auto I) {
+      using M          = Type<I>;
+      const auto & arr = std::get<I>(m_arrays);
+      if (I < s.type) {
+        ret += traits::man<std::vector<M>>::dof(arr);
+      } else if (I == s.type) {
+        if constexpr (traits::man<M>::Dof > 0) {
+          ret += static_cast<Eigen::Index>(s.index) * traits::man<M>::Dof;
+        } else {
+          for (auto i = 0u; i < s.index; ++i) { ret += traits::man<M>::dof(arr[i]); }
+        }
+      }
+    });
+    return ret;
+  }
+
+  /// @brief In-place right-plus.
+  template<typename Derived>
+  void rplus_assign(const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts = kSerial)
+  {
+    assert(a.size() == dof());
+
+    Eigen::Index dof_cntr = 0;
+    utils::static_for<NumTypes>([&](auto I) {
+      using V          = std::vector<Type<I>>;
+      auto & arr       = std::get<I>(m_arrays);
+      const auto dof_I = traits::man<V>::dof(arr);
+      traits::man<V>::rplus_assign(arr, a.segment(dof_cntr, dof_I), opts);
+      dof_cntr += dof_I;
+    });
+  }
+
+  /// @brief Right-plus.
+  template<typename Derived>
+  ManifoldPool rplus(const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts = kSerial) const
+  {
+    ManifoldPool ret(*this);
+    ret.rplus_assign(a, opts);
+    return ret;
+  }
+
+  /**
+   * @brief Right-minus.
+   *
+   * @note Both pools must contain the same number of elements of each type.
+   */
+  Eigen::VectorX<Scalar> rminus(const ManifoldPool & other, const ManifoldVectorOptions & opts = kSerial) const
+  {
+    Eigen::VectorX<Scalar> ret(dof());
+
+    Eigen::Index dof_cntr = 0;
+    utils::static_for<NumTypes>([&](auto I) {
+      using V          = std::vector<Type<I>>;
+      const auto & arr = std::get<I>(m_arrays);
+      assert(arr.size() == std::get<I>(other.m_arrays).size());
+      const auto dof_I             = traits::man<V>::dof(arr);
+      ret.segment(dof_cntr, dof_I) = traits::man<V>::rminus(arr, std::get<I>(other.m_arrays), opts);
+      dof_cntr += dof_I;
+    });
+
+    return ret;
+  }
+
+  /// @brief Cast to different scalar type.
+  template<typename NewScalar>
+  ManifoldPool<typename traits::man<Ms>::template CastT<NewScalar>...> cast() const
+  {
+    ManifoldPool<typename traits::man<Ms>::template CastT<NewScalar>...> ret;
+    utils::static_for<NumTypes>([&](auto I) {
+      std::get<I>(ret.m_arrays) = traits::man<std::vector<Type<I>>>::template cast<NewScalar>(std::get<I>(m_arrays));
+    });
+    ret.m_slots.reserve(m_slots.size());
+    for (const auto & s : m_slots) { ret.m_slots.push_back({s.type, s.index}); }
+    return ret;
+  }
+
+private:
+  template<Manifold... Ns>
+    requires(sizeof...(Ns) > 0)
+  friend class ManifoldPool;
+
+  template<typename M>
+  static constexpr std::size_t TypeCount = (std::size_t{std::is_same_v<M, Ms>} + ...);
+
+  static_assert(((TypeCount<Ms> == 1) && ...), "Element types must be distinct");
+  static_assert(
+    (std::is_same_v<typename traits::man<Ms>::Scalar, Scalar> && ...), "Element types must have the same Scalar");
+
+  static constexpr ManifoldVectorOptions kSerial{.num_threads = 1};
+
+  std::tuple<std::vector<Ms>...> m_arrays{};
+  std::vector<Slot> m_slots{};
+};
+
+namespace traits {
+
+/// @brief Manifold specialization for ManifoldPool
+template<Manifold... Ms>
+struct man<ManifoldPool<Ms...>>
+{
+  // \cond
+  using Scalar      = typename ManifoldPool<Ms...>::Scalar;
+  using PlainObject = ManifoldPool<Ms...>;
+  template<typename NewScalar>
+  using CastT = ManifoldPool<typename traits::man<Ms>::template CastT<NewScalar>...>;
+
+  static constexpr int Dof = -1;
+
+  static inline Eigen::Index dof(const PlainObject & m) { return m.dof(); }
+
+  static inline PlainObject Default(Eigen::Index dof)
+  {
+    using M0 = typename PlainObject::template Type<0>;
+
+    PlainObject ret;
+    for (auto v : traits::man<std::vector<M0>>::Default(dof)) { ret.push_back(std::move(v)); }
+    return ret;
+  }
+
+  template<typename NewScalar>
+  static inline CastT<NewScalar> cast(const PlainObject & m)
+  {
+    return m.template cast<NewScalar>();
+  }
+
+  template<typename Derived>
+  static inline PlainObject rplus(const PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    return m.rplus(a);
+  }
+
+  template<typename Derived>
+  static inline void rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    m.rplus_assign(a);
+  }
+
+  template<typename Derived>
+  static inline void
+  rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts)
+  {
+    m.rplus_assign(a, opts);
+  }
+
+  static inline Eigen::Vector<Scalar, Dof> rminus(const PlainObject & m1, const PlainObject & m2)
+  {
+    return m1.rminus(m2);
+  }
+  // \endcond
+};
+
+}  // namespace traits
+
+SMOOTH_END_NAMESPACE
@@ -3,6 +3,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
+#include <memory>
 
 #include "smooth/concepts/manifold.hpp"
 
@@ -63,6 +67,15 @@ public:
   /// @brief Right-plus
   template<typename Derived>
   SubManifold<M> rplus(const Eigen::MatrixBase<Derived> & a) const
+  {
+    SubManifold<M> ret(*this);
+    ret.rplus_assign(a);
+    return ret;
+  }
+
+  /// @brief In-place right-plus
+  template<typename Derived>
+  void rplus_assign(const Eigen::MatrixBase<Derived> & a)
   {
     assert(dof() == a.size());
     m_calc.setZero(::smooth::dof(m_m0));
@@ -76,7 +89,7 @@ public:
         ++k;
       }
     }
-    return SubManifold<M>(m_m0, traits::man<M>::rplus(m_m, m_calc), m_fixed_dims);
+    ::smooth::rplus_assign(m_m, m_calc);
   }
 
   /// @brief Right-minus
@@ -111,6 +124,103 @@ private:
   mutable Tangent<M> m_calc{};
 };
 
+/**
+ * @brief Submanifold with compile-time fixed dimensions.
+ *
+ * Same as SubManifold but the fixed dimensions are template parameters, which gives a static
+ * number of degrees of freedom and lets rplus and rminus scatter/gather with a precomputed index
+ * array instead of merging with the fixed dimensions at run time. Operations use no mutable
+ * scratch memory and are safe to call concurrently, and copies share the (immutable) origin.
+ *
+ * @tparam M manifold with static Dof
+ * @tparam FixedDims strictly increasing list of fixed dimensions in [0, Dof<M>)
+ */
+template<Manifold M, int... FixedDims>
+  requires(Dof<M> > 0 && sizeof...(FixedDims) < static_cast<std::size_t>(Dof<M>))
+class StaticSubManifold
+{
+  static constexpr std::array<int, sizeof...(FixedDims)> Fixed{FixedDims...};
+
+  static_assert(
+    std::ranges::all_of(Fixed, [](int i) { return 0 <= i && i < ::smooth::Dof<M>; }), "Dimension out of range");
+  static_assert(std::ranges::is_sorted(Fixed, std::less_equal<int>{}), "Dimensions must be strictly increasing");
+
+public:
+  /// @brief Degrees of freedom.
+  static constexpr int Dof = ::smooth::Dof<M> - static_cast<int>(sizeof...(FixedDims));
+
+  /// @brief Active dimensions of M in increasing order.
+  static constexpr std::array<int, static_cast<std::size_t>(Dof)> ActiveDims = [] {
+    std::array<int, static_cast<std::size_t>(Dof)> ret{};
+    for (int i = 0, j = 0; i < ::smooth::Dof<M>; ++i) {
+      if (std::ranges::find(Fixed, i) == Fixed.end()) { ret[static_cast<std::size_t>(j++)] = i; }
+    }
+    return ret;
+  }();
+
+  /**
+   * @brief Construct with default origin and value.
+   */
+  StaticSubManifold() : StaticSubManifold(Default<M>()) {}
+
+  /**
+   * @brief Construct with origin m0 and value m0.
+   */
+  explicit StaticSubManifold(const M & m0) : StaticSubManifold(std::make_shared<const M>(m0), m0) {}
+
+  /**
+   * @brief Construct with a shared origin and value m.
+   */
+  StaticSubManifold(std::shared_ptr<const M> m0, const M & m) : m_m0(std::move(m0)), m_m(m) { assert(m_m0); }
+
+  /// @brief Access value in embedded space
+  const M & m() const { return m_m; }
+
+  /// @brief Access origin in embedded space
+  const M & m0() const { return *m_m0; }
+
+  /// @brief Access shared origin
+  const std::shared_ptr<const M> & m0_ptr() const { return m_m0; }
+
+  /// @brief Degrees of freedom
+  Eigen::Index dof() const { return Dof; }
+
+  /// @brief Right-plus
+  template<typename Derived>
+  StaticSubManifold rplus(const Eigen::MatrixBase<Derived> & a) const
+  {
+    StaticSubManifold ret(*this);
+    ret.rplus_assign(a);
+    return ret;
+  }
+
+  /// @brief In-place right-plus
+  template<typename Derived>
+  void rplus_assign(const Eigen::MatrixBase<Derived> & a)
+  {
+    assert(a.size() == Dof);
+    Tangent<M> a_full = Tangent<M>::Zero();
+    for (auto k = 0u; k < ActiveDims.size(); ++k) { a_full(ActiveDims[k]) = a(k); }
+    ::smooth::rplus_assign(m_m, a_full);
+  }
+
+  /// @brief Right-minus
+  Eigen::Vector<typename traits::man<M>::Scalar, Dof> rminus(const StaticSubManifold & other) const
+  {
+    assert(m_m0 == other.m_m0 || traits::man<M>::rminus(*m_m0, *other.m_m0).isZero());
+
+    const Tangent<M> d_full = traits::man<M>::rminus(m_m, other.m_m);
+
+    Eigen::Vector<typename traits::man<M>::Scalar, Dof> ret;
+    for (auto k = 0u; k < ActiveDims.size(); ++k) { ret(k) = d_full(ActiveDims[k]); }
+    return ret;
+  }
+
+private:
+  std::shared_ptr<const M> m_m0;
+  M m_m{};
+};
+
 namespace traits {
 
 /// @brief Manifold specialization for SubManifold
@@ -145,6 +255,53 @@ struct man<SubManifold<M>>
     return m.rplus(a);
   }
 
+  template<typename Derived>
+  static inline void rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    m.rplus_assign(a);
+  }
+
+  static inline Eigen::Vector<Scalar, Dof> rminus(const PlainObject & m1, const PlainObject & m2)
+  {
+    return m1.rminus(m2);
+  }
+};
+
+/// @brief Manifold specialization for StaticSubManifold
+template<Manifold M, int... FixedDims>
+struct man<StaticSubManifold<M, FixedDims...>>
+{
+  using Scalar      = man<M>::Scalar;
+  using PlainObject = StaticSubManifold<M, FixedDims...>;
+  template<typename NewScalar>
+  using CastT = StaticSubManifold<typename man<M>::template CastT<NewScalar>, FixedDims...>;
+
+  static constexpr int Dof = PlainObject::Dof;
+
+  static inline Eigen::Index dof(const PlainObject &) { return Dof; }
+
+  static inline PlainObject Default(Eigen::Index) { return PlainObject(); }
+
+  template<typename NewScalar>
+  static inline CastT<NewScalar> cast(const PlainObject & m)
+  {
+    using MNew = typename man<M>::template CastT<NewScalar>;
+    return CastT<NewScalar>(
+      std::make_shared<const MNew>(man<M>::template cast<NewScalar>(m.m0())), man<M>::template cast<NewScalar>(m.m()));
+  }
+
+  template<typename Derived>
+  static inline PlainObject rplus(const PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    return m.rplus(a);
+  }
+
+  template<typename Derived>
+  static inline void rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    m.rplus_assign(a);
+  }
+
   static inline Eigen::Vector<Scalar, Dof> rminus(const PlainObject & m1, const PlainObject & m2)
   {
     return m1.rminus(m2);
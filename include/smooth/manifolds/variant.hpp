@@ -56,6 +56,13 @@ struct man<std::variant<Ms...>>
     return std::visit(visitor, m);
   }
 
+  template<typename Derived>
+  static inline void rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  {
+    const auto visitor = [&a]<Manifold Mi>(Mi & x) { ::smooth::rplus_assign(x, a); };
+    std::visit(visitor, m);
+  }
+
   static inline Eigen::Matrix<Scalar, Dof, 1> rminus(const PlainObject & m1, const PlainObject & m2)
   {
     const auto visitor = [&m2]<Manifold Mi>(const Mi & x) -> Eigen::VectorX<Scalar> {
@@ -8,14 +8,81 @@
  */
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
 #include <ranges>
 #include <vector>
 
 #include "smooth/concepts/manifold.hpp"
-#include "smooth/detail/utils.hpp"
+#include "smooth/detail/parallel.hpp"
 
 SMOOTH_BEGIN_NAMESPACE
 
+/**
+ * @brief Execution options for rplus, rplus_assign and rminus on std::vector<Manifold>.
+ *
+ * Vectors with more than min_chunk elements are split into chunks of at least min_chunk elements
+ * that are processed on separate threads. Element offsets into the tangent vector are i * Dof for
+ * static-size elements, and for dynamic-size elements they are obtained from a parallel per-chunk
+ * reduction of the element dofs.
+ *
+ * The Manifold interface (e.g. rplus(m, a)) processes vectors serially. The overloads at the end of
+ * this file take options and split the work over threads, and minimize() passes
+ * MinimizeOptions::vector_exec to them when it updates std::vector<Manifold> variables.
+ */
+struct ManifoldVectorOptions
+{
+  /// maximum number of threads (0 means std::thread::hardware_concurrency())
+  std::size_t num_threads{0};
+  /// minimum number of elements per thread
+  std::size_t min_chunk{4096};
+};
+
+namespace detail {
+
+/**
+ * @brief Call f(i, dof_cntr, dof_i) for all elements m[i] of a std::vector<Manifold>.
+ *
+ * dof_cntr is the offset of element i in the tangent vector and dof_i its degrees of freedom.
+ * Calls for different i may happen concurrently.
+ */
+template<typename V, typename F>
+void manifold_vector_for_each(V & m, const ManifoldVectorOptions & opts, F && f)
+{
+  using M = typename std::decay_t<V>::value_type;
+
+  const std::size_t N = m.size();
+  const std::size_t C = parallel_num_chunks(N, opts.num_threads, opts.min_chunk);
+
+  if constexpr (traits::man<M>::Dof > 0) {
+    static constexpr Eigen::Index Nx = traits::man<M>::Dof;
+    parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t) {
+      for (auto i = b; i < e; ++i) { f(i, static_cast<Eigen::Index>(i) * Nx, Nx); }
+    });
+  } else {
+    // tangent offset at the start of each chunk
+    std::vector<Eigen::Index> chunk_begin(C + 1, 0);
+    if (C > 1) {
+      parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t c) {
+        for (auto i = b; i < e; ++i) { chunk_begin[c + 1] += traits::man<M>::dof(m[i]); }
+      });
+      std::partial_sum(chunk_begin.begin(), chunk_begin.end(), chunk_begin.begin());
+    }
+
+    parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t c) {
+      Eigen::Index dof_cntr = chunk_begin[c];
+      for (auto i = b; i < e; ++i) {
+        const Eigen::Index dof_i = traits::man<M>::dof(m[i]);
+        f(i, dof_cntr, dof_i);
+        dof_cntr += dof_i;
+      }
+    });
+  }
+}
+
+}  // namespace detail
+
 namespace traits {
 /**
  * @brief Manifold model specification for std::vector<Manifold>
@@ -60,41 +127,71 @@ struct man<std::vector<M>>
   }
 
   template<typename Derived>
-  static inline PlainObject rplus(const PlainObject & m, const Eigen::MatrixBase<Derived> & a)
+  static inline PlainObject
+  rplus(const PlainObject & m, const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts = kSerial)
   {
-    PlainObject m_plus_a;
-    m_plus_a.reserve(m.size());
-    for (Eigen::Index dof_cntr = 0; const auto & mi : m) {
-      const auto dof_i = traits::man<M>::dof(mi);
-      m_plus_a.push_back(traits::man<M>::rplus(mi, a.template segment<traits::man<M>::Dof>(dof_cntr, dof_i)));
-      dof_cntr += dof_i;
-    }
+    PlainObject m_plus_a = m;
+    rplus_assign(m_plus_a, a, opts);
     return m_plus_a;
   }
 
-  static inline Eigen::Matrix<Scalar, Dof, 1> rminus(const PlainObject & m1, const PlainObject & m2)
+  template<typename Derived>
+  static inline void
+  rplus_assign(PlainObject & m, const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts = kSerial)
   {
-    Eigen::Index dof_cnts = 0;
-    if (traits::man<M>::Dof > 0) {
-      dof_cnts = static_cast<Eigen::Index>(traits::man<M>::Dof * static_cast<Eigen::Index>(m1.size()));
-    } else {
-      for (auto i = 0u; i != m1.size(); ++i) { dof_cnts += ::smooth::dof<M>(m1[i]); }
-    }
+    ::smooth::detail::manifold_vector_for_each(
+      m, opts, [&](std::size_t i, Eigen::Index dof_cntr, Eigen::Index dof_i) {
+        ::smooth::rplus_assign(m[i], a.template segment<traits::man<M>::Dof>(dof_cntr, dof_i));
+      });
+  }
 
-    Eigen::VectorX<Scalar> ret(dof_cnts);
+  static inline Eigen::Matrix<Scalar, Dof, 1>
+  rminus(const PlainObject & m1, const PlainObject & m2, const ManifoldVectorOptions & opts = kSerial)
+  {
+    assert(m1.size() == m2.size());
 
-    for (Eigen::Index idx = 0; const auto & [m1i, m2i] : utils::zip(m1, m2)) {
-      const auto & size_i = ::smooth::dof<M>(m1i);
+    Eigen::VectorX<Scalar> ret(dof(m1));
 
-      ret.template segment<traits::man<M>::Dof>(idx, size_i) = traits::man<M>::rminus(m1i, m2i);
-      idx += size_i;
-    }
+    ::smooth::detail::manifold_vector_for_each(
+      m1, opts, [&](std::size_t i, Eigen::Index dof_cntr, Eigen::Index dof_i) {
+        ret.template segment<traits::man<M>::Dof>(dof_cntr, dof_i) = traits::man<M>::rminus(m1[i], m2[i]);
+      });
 
     return ret;
   }
+
+  static constexpr ManifoldVectorOptions kSerial{.num_threads = 1};
   // \endcond
 };
 
 }  // namespace traits
 
+/**
+ * @brief Right-plus of std::vector<Manifold> with execution options.
+ */
+template<Manifold M, typename Derived>
+std::vector<M> rplus(const std::vector<M> & m, const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts)
+{
+  return traits::man<std::vector<M>>::rplus(m, a, opts);
+}
+
+/**
+ * @brief In-place right-plus of std::vector<Manifold> with execution options.
+ */
+template<Manifold M, typename Derived>
+void rplus_assign(std::vector<M> & m, const Eigen::MatrixBase<Derived> & a, const ManifoldVectorOptions & opts)
+{
+  traits::man<std::vector<M>>::rplus_assign(m, a, opts);
+}
+
+/**
+ * @brief Right-minus of std::vector<Manifold> with execution options.
+ */
+template<Manifold M>
+Eigen::VectorX<Scalar<M>>
+rminus(const std::vector<M> & m1, const std::vector<M> & m2, const ManifoldVectorOptions & opts)
+{
+  return traits::man<std::vector<M>>::rminus(m1, m2, opts);
+}
+
 SMOOTH_END_NAMESPACE
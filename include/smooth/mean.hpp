@@ -0,0 +1,171 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+/**
+ * @file
+ * @brief Karcher (Fréchet) mean and tangent-space covariance of Lie group samples.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "concepts/lie_group.hpp"
+#include "detail/parallel.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+struct MeanOptions
+{
+  /// maximum number of iterations
+  std::size_t max_iter{50};
+  /// absolute tolerance on the norm of the tangent-space update for convergence
+  double ptol{1e-12};
+  /// maximum number of threads (0 means std::thread::hardware_concurrency())
+  std::size_t num_threads{0};
+  /// minimum number of samples per thread
+  std::size_t min_chunk{8192};
+};
+
+/**
+ * @brief Result of karcher_mean().
+ */
+template<LieGroup G>
+struct MeanResult
+{
+  /// mean element
+  PlainObject<G> mean;
+  /// covariance of the tangent-space residuals \f$ g_i \ominus_r \mu \f$
+  TangentMap<G> cov;
+  /// number of updates of the mean
+  std::size_t iter;
+  /// true if the update norm fell below MeanOptions::ptol
+  bool converged;
+};
+
+namespace detail {
+
+/**
+ * @brief Weighted Karcher mean with weights given by w(i).
+ */
+template<std::ranges::random_access_range R, typename W>
+auto karcher_mean_impl(const R & gs, W && w, const MeanOptions & opts)
+{
+  using G = PlainObject<std::ranges::range_value_t<R>>;
+  using S = Scalar<G>;
+
+  assert(!std::ranges::empty(gs));
+
+  const auto N          = static_cast<std::size_t>(std::ranges::size(gs));
+  const Eigen::Index nx = dof(*std::ranges::begin(gs));
+  const std::size_t C   = parallel_num_chunks(N, opts.num_threads, opts.min_chunk);
+
+  struct Partial
+  {
+    S wsum;
+    Tangent<G> e;
+    TangentMap<G> ee;
+  };
+
+  std::vector<Partial> partials(C);
+
+  MeanResult<G> ret{
+    .mean      = *std::ranges::begin(gs),
+    .cov       = TangentMap<G>::Zero(nx, nx),
+    .iter      = 0,
+    .converged = false,
+  };
+
+  // weighted mean of residuals at ret.mean, and covariance of residuals stored in ret.cov
+  const auto residual_pass = [&]() -> Tangent<G> {
+    // weighted sums of residuals and their outer products, reduced per chunk
+    parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t c) {
+      S wsum_c           = S(0);
+      Tangent<G> e_c     = Tangent<G>::Zero(nx);
+      TangentMap<G> ee_c = TangentMap<G>::Zero(nx, nx);
+      for (auto i = b; i < e; ++i) {
+        const S wi          = static_cast<S>(w(i));
+        const Tangent<G> ei = rminus(std::ranges::begin(gs)[static_cast<std::ptrdiff_t>(i)], ret.mean);
+        wsum_c += wi;
+        e_c.noalias() += wi * ei;
+        ee_c.noalias() += wi * ei * ei.transpose();
+      }
+      partials[c] = Partial{wsum_c, std::move(e_c), std::move(ee_c)};
+    });
+
+    S wsum           = S(0);
+    Tangent<G> delta = Tangent<G>::Zero(nx);
+    ret.cov.setZero(nx, nx);
+    for (const auto & p : partials) {
+      wsum += p.wsum;
+      delta += p.e;
+      ret.cov += p.ee;
+    }
+    ret.cov /= wsum;
+    return delta / wsum;
+  };
+
+  // every update is followed by a residual pass, so that ret.cov is evaluated at the returned mean
+  Tangent<G> delta = residual_pass();
+  ret.converged    = static_cast<double>(delta.norm()) < opts.ptol;
+  while (!ret.converged && ret.iter < opts.max_iter) {
+    ret.mean = rplus(ret.mean, delta);
+    ++ret.iter;
+
+    delta         = residual_pass();
+    ret.converged = static_cast<double>(delta.norm()) < opts.ptol;
+  }
+
+  return ret;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Karcher (Fréchet) mean of Lie group samples.
+ *
+ * Iteratively solves
+ * \f[
+ *   \mu = \arg \min_{\mu} \sum_i \| g_i \ominus_r \mu \|^2
+ * \f]
+ * with the fixed-point iteration \f$ \mu \leftarrow \mu \oplus_r \frac{1}{N} \sum_i (g_i \ominus_r \mu) \f$
+ * starting from the first sample. The sum over samples is evaluated in parallel.
+ *
+ * The returned covariance is \f$ \frac{1}{N} \sum_i e_i e_i^T \f$ where \f$ e_i = g_i \ominus_r \mu \f$
+ * are the residuals at the returned mean.
+ *
+ * @param gs non-empty range of samples
+ * @param opts options
+ */
+template<std::ranges::random_access_range R>
+  requires(LieGroup<std::ranges::range_value_t<R>> && std::ranges::sized_range<R>)
+MeanResult<PlainObject<std::ranges::range_value_t<R>>> karcher_mean(const R & gs, const MeanOptions & opts = {})
+{
+  return detail::karcher_mean_impl(gs, [](std::size_t) { return 1; }, opts);
+}
+
+/**
+ * @brief Weighted Karcher (Fréchet) mean of Lie group samples.
+ *
+ * As karcher_mean() but minimizes \f$ \sum_i w_i \| g_i \ominus_r \mu \|^2 \f$, and returns the
+ * covariance \f$ \sum_i w_i e_i e_i^T / \sum_i w_i \f$.
+ *
+ * @param gs non-empty range of samples
+ * @param ws range of non-negative weights with the same size as gs and positive sum
+ * @param opts options
+ */
+template<std::ranges::random_access_range R, std::ranges::random_access_range W>
+  requires(LieGroup<std::ranges::range_value_t<R>> && std::ranges::sized_range<R>)
+MeanResult<PlainObject<std::ranges::range_value_t<R>>>
+karcher_mean(const R & gs, const W & ws, const MeanOptions & opts = {})
+{
+  assert(std::ranges::size(gs) == std::ranges::size(ws));
+
+  return detail::karcher_mean_impl(
+    gs, [&ws](std::size_t i) { return std::ranges::begin(ws)[static_cast<std::ptrdiff_t>(i)]; }, opts);
+}
+
+SMOOTH_END_NAMESPACE
@@ -18,6 +18,7 @@
 
 #include "detail/math.hpp"
 #include "diff.hpp"
+#include "manifolds/vector.hpp"
 #include "optim/tr_solver.hpp"
 #include "optim/tr_strategy.hpp"
 
@@ -35,6 +36,8 @@ struct MinimizeOptions
   std::size_t max_iter{1000};
   /// print solver status to stdout
   bool verbose{false};
+  /// execution options for the update of std::vector<Manifold> variables (serial by default)
+  ManifoldVectorOptions vector_exec{.num_threads = 1};
 };
 
 struct SolveResult
@@ -71,6 +74,10 @@ SolveResult minimize(auto && f, auto && x, auto && cb, const MinimizeOptions & o
   // execute callback on initial value
   std::apply(cb, x);
 
+  // trial point, re-used between iterations and updated in place
+  auto xp = std::apply(
+    [](const auto &... xi) { return std::make_tuple(PlainObject<std::decay_t<decltype(xi)>>(xi)...); }, x);
+
   for (; iter < opts.max_iter && !status.has_value(); ++iter) {
     // evaluate residuals and jacobian
     const auto [r, J] = diff::dr<1, D>(f, x);
@@ -94,7 +101,8 @@ SolveResult minimize(auto && f, auto && x, auto && cb, const MinimizeOptions & o
     // trust region step
     const double Delta      = opts.strat->get_delta();
     const auto [dx, lambda] = solve_trust_region(J, d, r, Delta);
-    const auto xp           = wrt_rplus(x, dx);
+    xp                      = x;
+    wrt_rplus_assign(xp, dx, opts.vector_exec);
 
     // actual to relative reduction
     const double r_n      = r.stableNorm();
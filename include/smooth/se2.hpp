@@ -134,6 +134,43 @@ public:
     return ret;
   }
 
+  /**
+   * @brief Transformation action on a batch of 2D vectors.
+   *
+   * The rotation matrix is computed once and applied to all columns.
+   *
+   * @param V 2 x N matrix of vectors
+   * @return 2 x N matrix with columns \f$ X v_i \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 2, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    Eigen::Matrix<Scalar, 2, EigenDerived::ColsAtCompileTime> ret = so2().matrix() * V;
+    ret.colwise() += r2();
+    return ret;
+  }
+
+  /**
+   * @brief Jacobians of transformation action on a batch of 2D vectors w.r.t. group.
+   *
+   * @param V 2 x N matrix of vectors
+   * @return 2 x 3N matrix with horizontally stacked blocks \f$ \mathrm{d}^r (X v_i)_X \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 2, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    const Eigen::Matrix2<Scalar> R                                     = so2().matrix();
+    const Eigen::Matrix<Scalar, 2, EigenDerived::ColsAtCompileTime> dR = so2().dr_action_batch(V);
+
+    Eigen::Matrix<Scalar, 2, -1> ret(2, 3 * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      ret.template middleCols<2>(3 * i) = R;
+      ret.col(3 * i + 2)                = dR.col(i);
+    }
+    return ret;
+  }
+
   /**
    * @brief Lift to SE3.
    *
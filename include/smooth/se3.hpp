@@ -134,6 +134,41 @@ public:
     return ret;
   }
 
+  /**
+   * @brief Transformation action on a batch of 3D vectors.
+   *
+   * The rotation matrix is computed once and applied to all columns.
+   *
+   * @param V 3 x N matrix of vectors
+   * @return 3 x N matrix with columns \f$ X v_i \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    Eigen::Matrix<Scalar, 3, EigenDerived::ColsAtCompileTime> ret = so3().matrix() * V;
+    ret.colwise() += r3();
+    return ret;
+  }
+
+  /**
+   * @brief Jacobians of transformation action on a batch of 3D vectors w.r.t. group.
+   *
+   * @param V 3 x N matrix of vectors
+   * @return 3 x 6N matrix with horizontally stacked blocks \f$ \mathrm{d}^r (X v_i)_X \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    const Eigen::Matrix3<Scalar> R = so3().matrix();
+    Eigen::Matrix<Scalar, 3, -1> ret(3, 6 * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      ret.template middleCols<3>(6 * i)               = R;
+      ret.template middleCols<3>(6 * i + 3).noalias() = -R * SO3<Scalar>::hat(V.col(i));
+    }
+    return ret;
+  }
+
   /**
    * @brief Project to SE2.
    *
@@ -237,9 +272,167 @@ class Map<const SE3<_Scalar>> : public SE3Base<Map<const SE3<_Scalar>>>
   SMOOTH_CONST_MAP_API();
 };
 
+// \cond
+template<typename _Scalar>
+class SE3Cached;
+// \endcond
+
+// \cond
+template<typename _Scalar>
+struct liebase_info<SE3Cached<_Scalar>> : public liebase_info<SE3<_Scalar>>
+{
+  static constexpr bool is_mutable = false;
+};
+// \endcond
+
+/**
+ * @brief Immutable SE3 storage that caches the rotation matrix.
+ *
+ * Stores the 3x3 rotation matrix alongside the coefficients so that actions, their Jacobians, Ad()
+ * and matrix() do not rebuild it from the quaternion on every call. This costs 9 extra scalars and
+ * a matrix computation on construction.
+ *
+ * Group operations such as composition and inverse return plain SE3 objects.
+ *
+ * @see SE3Base for memory layout.
+ */
+template<typename _Scalar>
+class SE3Cached : public SE3Base<SE3Cached<_Scalar>>
+{
+  using Base = SE3Base<SE3Cached<_Scalar>>;
+
+public:
+  SMOOTH_INHERIT_TYPEDEFS;
+
+  /// @brief Matrix Lie group type.
+  using Matrix = typename Base::Matrix;
+  /// @brief Tangent map type.
+  using TangentMap = typename Base::TangentMap;
+
+  /// @brief Underlying storage is an Eigen matrix
+  using Storage = Eigen::Matrix<Scalar, RepSize, 1>;
+
+  /**
+   * @brief Construct identity element.
+   */
+  SE3Cached() : m_R(Eigen::Matrix3<Scalar>::Identity())
+  {
+    m_coeffs.setZero();
+    m_coeffs(6) = Scalar(1);
+  }
+
+  /**
+   * @brief Construct from other SE3 storage type.
+   */
+  template<typename OtherDerived>
+  SE3Cached(const SE3Base<OtherDerived> & o) noexcept
+      : m_coeffs(static_cast<const OtherDerived &>(o).coeffs()), m_R(o.so3().quat().toRotationMatrix())
+  {}
+
+  /**
+   * @brief Construct from SO3 and translation.
+   *
+   * @param so3 orientation component.
+   * @param r3 translation component.
+   */
+  template<typename SO3Derived, typename T3Derived>
+  SE3Cached(const SO3Base<SO3Derived> & so3, const Eigen::MatrixBase<T3Derived> & r3)
+      : SE3Cached(SE3<Scalar>(so3, r3))
+  {}
+
+  /// @brief Const access underlying Eigen::Matrix
+  inline const Storage & coeffs() const noexcept { return m_coeffs; }
+  /// @brief Const access raw pointer
+  inline const Scalar * data() const noexcept { return m_coeffs.data(); }
+
+  /**
+   * @brief Cached rotation matrix.
+   */
+  const Eigen::Matrix3<Scalar> & rotation_matrix() const noexcept { return m_R; }
+
+  /**
+   * @brief Return as 4x4 homogeneous matrix.
+   */
+  Matrix matrix() const noexcept
+  {
+    Matrix ret;
+    ret.template topLeftCorner<3, 3>()  = m_R;
+    ret.template topRightCorner<3, 1>() = Base::r3();
+    ret.template bottomRows<1>() << Scalar(0), Scalar(0), Scalar(0), Scalar(1);
+    return ret;
+  }
+
+  /**
+   * @brief Group adjoint.
+   */
+  TangentMap Ad() const noexcept
+  {
+    TangentMap ret;
+    ret.template topLeftCorner<3, 3>()            = m_R;
+    ret.template topRightCorner<3, 3>().noalias() = SO3<Scalar>::hat(Base::r3()) * m_R;
+    ret.template bottomRightCorner<3, 3>()        = m_R;
+    ret.template bottomLeftCorner<3, 3>().setZero();
+    return ret;
+  }
+
+  /**
+   * @brief Tranformation action on 3D vector.
+   */
+  template<typename EigenDerived>
+  Eigen::Vector3<Scalar> operator*(const Eigen::MatrixBase<EigenDerived> & v) const
+  {
+    return m_R * v + Base::r3();
+  }
+
+  /**
+   * @brief Jacobian of rotation action w.r.t. group.
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, 6> dr_action(const Eigen::MatrixBase<EigenDerived> & v) const
+  {
+    Eigen::Matrix<Scalar, 3, 6> ret;
+    ret.template leftCols<3>()            = m_R;
+    ret.template rightCols<3>().noalias() = -m_R * SO3<Scalar>::hat(v);
+    return ret;
+  }
+
+  /**
+   * @brief Transformation action on a batch of 3D vectors.
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    Eigen::Matrix<Scalar, 3, EigenDerived::ColsAtCompileTime> ret = m_R * V;
+    ret.colwise() += Base::r3();
+    return ret;
+  }
+
+  /**
+   * @brief Jacobians of transformation action on a batch of 3D vectors w.r.t. group.
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    Eigen::Matrix<Scalar, 3, -1> ret(3, 6 * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      ret.template middleCols<3>(6 * i)               = m_R;
+      ret.template middleCols<3>(6 * i + 3).noalias() = -m_R * SO3<Scalar>::hat(V.col(i));
+    }
+    return ret;
+  }
+
+private:
+  Storage m_coeffs;
+  Eigen::Matrix3<Scalar> m_R;
+};
+
 using SE3f = SE3<float>;   ///< SE3 with float
 using SE3d = SE3<double>;  ///< SE3 with double
 
+using SE3Cachedf = SE3Cached<float>;   ///< SE3Cached with float
+using SE3Cachedd = SE3Cached<double>;  ///< SE3Cached with double
+
 SMOOTH_END_NAMESPACE
 
 // Std format
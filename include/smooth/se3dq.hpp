@@ -0,0 +1,227 @@
+// Copyright (C) 2021-2022 Petter Nilsson. MIT License.
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "detail/macro.hpp"
+#include "detail/se3dq.hpp"
+#include "lie_group_base.hpp"
+#include "se3.hpp"
+#include "so3.hpp"
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief Base class for SE3 Lie group types represented as unit dual quaternions.
+ *
+ * Internally represented as a unit dual quaternion \f$ r + \epsilon d \f$ where \f$ r \in
+ * \mathbb{S}^3 \f$ is the rotation and \f$ d = \frac{1}{2} (T, 0) \otimes r \f$ encodes the
+ * translation. Composition only requires quaternion products, which makes this representation
+ * suitable for composing long chains of transformations.
+ *
+ * The tangent space, matrix forms, and all tangent-space derivatives are identical to SE3Base, so
+ * tangent vectors obtained from SE3DQ and SE3 are interchangeable.
+ *
+ * Memory layout
+ * -------------
+ *
+ * - Group:    \f$ \mathbf{x} = [r_x, r_y, r_z, r_w, d_x, d_y, d_z, d_w] \f$
+ * - Tangent:  \f$ \mathbf{a} = [v_x, v_y, v_z, \omega_x, \omega_y, \omega_z] \f$
+ *
+ * Constraints
+ * -----------
+ *
+ * - Group:   \f$ |r| = 1, r \cdot d = 0, r_w \geq 0 \f$
+ * - Tangent: \f$ -\pi < \omega_x, \omega_y, \omega_z \leq \pi \f$
+ *
+ * @see SE3Base for matrix forms.
+ */
+template<typename _Derived>
+class SE3DQBase : public LieGroupBase<_Derived>
+{
+  using Base = LieGroupBase<_Derived>;
+
+protected:
+  SE3DQBase() = default;
+
+public:
+  SMOOTH_INHERIT_TYPEDEFS;
+
+  /**
+   * @brief Access real (rotation) part.
+   */
+  Eigen::Map<Eigen::Quaternion<Scalar>> real()
+    requires is_mutable
+  {
+    return Eigen::Map<Eigen::Quaternion<Scalar>>(static_cast<_Derived &>(*this).data());
+  }
+
+  /**
+   * @brief Const access real (rotation) part.
+   */
+  Eigen::Map<const Eigen::Quaternion<Scalar>> real() const
+  {
+    return Eigen::Map<const Eigen::Quaternion<Scalar>>(static_cast<const _Derived &>(*this).data());
+  }
+
+  /**
+   * @brief Access dual part.
+   */
+  Eigen::Map<Eigen::Quaternion<Scalar>> dual()
+    requires is_mutable
+  {
+    return Eigen::Map<Eigen::Quaternion<Scalar>>(static_cast<_Derived &>(*this).data() + 4);
+  }
+
+  /**
+   * @brief Const access dual part.
+   */
+  Eigen::Map<const Eigen::Quaternion<Scalar>> dual() const
+  {
+    return Eigen::Map<const Eigen::Quaternion<Scalar>>(static_cast<const _Derived &>(*this).data() + 4);
+  }
+
+  /**
+   * @brief Const access SO(3) part.
+   */
+  Map<const SO3<Scalar>> so3() const { return Map<const SO3<Scalar>>(static_cast<const _Derived &>(*this).data()); }
+
+  /**
+   * @brief Translation part.
+   */
+  Eigen::Vector3<Scalar> r3() const { return Scalar(2) * (dual() * real().conjugate()).vec(); }
+
+  /**
+   * @brief Convert to SE3.
+   */
+  SE3<Scalar> se3() const
+  {
+    SE3<Scalar> ret;
+    SE3DQImpl<Scalar>::to_se3(static_cast<const _Derived &>(*this).coeffs(), ret.coeffs());
+    return ret;
+  }
+
+  /**
+   * @brief Tranformation action on 3D vector.
+   */
+  template<typename EigenDerived>
+  Eigen::Vector3<Scalar> operator*(const Eigen::MatrixBase<EigenDerived> & v) const
+  {
+    return so3() * v + r3();
+  }
+
+  /**
+   * @brief Jacobian of rotation action w.r.t. group.
+   *
+   * \f[
+   *   \mathrm{d}^r (X v)_X
+   * \f]
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, 6> dr_action(const Eigen::MatrixBase<EigenDerived> & v) const
+  {
+    Eigen::Matrix<Scalar, 3, 6> ret;
+    ret.template leftCols<3>()  = so3().matrix();
+    ret.template rightCols<3>() = so3().dr_action(v);
+    return ret;
+  }
+};
+
+// \cond
+template<typename _Scalar>
+class SE3DQ;
+// \endcond
+
+// \cond
+template<typename _Scalar>
+struct liebase_info<SE3DQ<_Scalar>>
+{
+  static constexpr bool is_mutable = true;
+
+  using Impl   = SE3DQImpl<_Scalar>;
+  using Scalar = _Scalar;
+
+  template<typename NewScalar>
+  using PlainObject = SE3DQ<NewScalar>;
+};
+// \endcond
+
+/**
+ * @brief Storage implementation of SE3 Lie group as unit dual quaternion.
+ *
+ * @see SE3DQBase for memory layout.
+ */
+template<typename _Scalar>
+class SE3DQ : public SE3DQBase<SE3DQ<_Scalar>>
+{
+  using Base = SE3DQBase<SE3DQ<_Scalar>>;
+
+  SMOOTH_GROUP_API(SE3DQ);
+
+public:
+  /**
+   * @brief Construct from SO3 and translation.
+   *
+   * @param so3 orientation component.
+   * @param r3 translation component.
+   */
+  template<typename SO3Derived, typename T3Derived>
+  SE3DQ(const SO3Base<SO3Derived> & so3, const Eigen::MatrixBase<T3Derived> & r3) : SE3DQ(SE3<Scalar>(so3, r3))
+  {}
+
+  /**
+   * @brief Construct from SE3 element.
+   */
+  template<typename SE3Derived>
+  explicit SE3DQ(const SE3Base<SE3Derived> & se3)
+  {
+    SE3DQImpl<Scalar>::from_se3(static_cast<const SE3Derived &>(se3).coeffs(), m_coeffs);
+  }
+};
+
+// \cond
+template<typename _Scalar>
+struct liebase_info<Map<SE3DQ<_Scalar>>> : public liebase_info<SE3DQ<_Scalar>>
+{};
+// \endcond
+
+/**
+ * @brief Memory mapping of SE3DQ Lie group.
+ *
+ * @see SE3DQBase for memory layout.
+ */
+template<typename _Scalar>
+class Map<SE3DQ<_Scalar>> : public SE3DQBase<Map<SE3DQ<_Scalar>>>
+{
+  using Base = SE3DQBase<Map<SE3DQ<_Scalar>>>;
+
+  SMOOTH_MAP_API();
+};
+
+// \cond
+template<typename _Scalar>
+struct liebase_info<Map<const SE3DQ<_Scalar>>> : public liebase_info<SE3DQ<_Scalar>>
+{
+  static constexpr bool is_mutable = false;
+};
+// \endcond
+
+/**
+ * @brief Const memory mapping of SE3DQ Lie group.
+ *
+ * @see SE3DQBase for memory layout.
+ */
+template<typename _Scalar>
+class Map<const SE3DQ<_Scalar>> : public SE3DQBase<Map<const SE3DQ<_Scalar>>>
+{
+  using Base = SE3DQBase<Map<const SE3DQ<_Scalar>>>;
+
+  SMOOTH_CONST_MAP_API();
+};
+
+using SE3DQf = SE3DQ<float>;   ///< SE3DQ with float
+using SE3DQd = SE3DQ<double>;  ///< SE3DQ with double
+
+SMOOTH_END_NAMESPACE
@@ -141,6 +141,47 @@ public:
     assert(k < K);
     return Eigen::Map<const Eigen::Vector3<Scalar>>(static_cast<const _Derived &>(*this).data() + 3 * k);
   }
+
+  /**
+   * @brief Action on a batch of vectors in matrix form.
+   *
+   * The group acts on vectors \f$ (x, c_1, \ldots, c_k) \in \mathbb{R}^{3+k} \f$ as
+   * \f$ (R x + \sum_i c_i P_i, c_1, \ldots, c_k) \f$. The rotation matrix is computed once and
+   * applied to all columns.
+   *
+   * @param V (3+k) x N matrix of vectors
+   * @return (3+k) x N matrix with columns \f$ X v_i \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3 + K, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    const Eigen::Map<const Eigen::Matrix<Scalar, 3, K>> P(static_cast<const _Derived &>(*this).data());
+
+    Eigen::Matrix<Scalar, 3 + K, EigenDerived::ColsAtCompileTime> ret(3 + K, V.cols());
+    ret.template topRows<3>().noalias() = so3().matrix() * V.template topRows<3>() + P * V.template bottomRows<K>();
+    ret.template bottomRows<K>()        = V.template bottomRows<K>();
+    return ret;
+  }
+
+  /**
+   * @brief Jacobians of action on a batch of vectors w.r.t. group.
+   *
+   * @param V (3+k) x N matrix of vectors
+   * @return (3+k) x (3+3k)N matrix with horizontally stacked blocks \f$ \mathrm{d}^r (X v_i)_X \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3 + K, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    const Eigen::Matrix3<Scalar> R = so3().matrix();
+
+    Eigen::Matrix<Scalar, 3 + K, -1> ret = Eigen::Matrix<Scalar, 3 + K, -1>::Zero(3 + K, Dof * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      for (auto k = 0; k < K; ++k) { ret.template block<3, 3>(0, Dof * i + 3 * k) = V(3 + k, i) * R; }
+      ret.template block<3, 3>(0, Dof * i + 3 * K).noalias() = -R * SO3<Scalar>::hat(V.template block<3, 1>(0, i));
+    }
+    return ret;
+  }
 };
 
 // \cond
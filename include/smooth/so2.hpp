@@ -145,6 +145,34 @@ public:
     return Base::matrix() * Base::hat(Eigen::Vector<Scalar, 1>::Ones()) * v;
   }
 
+  /**
+   * @brief Rotation action on a batch of 2D vectors.
+   *
+   * The rotation matrix is computed once and applied to all columns.
+   *
+   * @param V 2 x N matrix of vectors
+   * @return 2 x N matrix with columns \f$ X v_i \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 2, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    return Base::matrix() * V;
+  }
+
+  /**
+   * @brief Jacobians of rotation action on a batch of 2D vectors w.r.t. group.
+   *
+   * @param V 2 x N matrix of vectors
+   * @return 2 x N matrix with horizontally stacked blocks \f$ \mathrm{d}^r (X v_i)_X \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 2, EigenDerived::ColsAtCompileTime>
+  dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    return (Base::matrix() * Base::hat(Eigen::Vector<Scalar, 1>::Ones())) * V;
+  }
+
   /**
    * @brief Lift to SO3.
    *
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
@@ -115,6 +117,38 @@ public:
     return -Base::matrix() * Base::hat(v);
   }
 
+  /**
+   * @brief Rotation action on a batch of 3D vectors.
+   *
+   * The rotation matrix is computed once and applied to all columns.
+   *
+   * @param V 3 x N matrix of vectors
+   * @return 3 x N matrix with columns \f$ X v_i \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    return Base::matrix() * V;
+  }
+
+  /**
+   * @brief Jacobians of rotation action on a batch of 3D vectors w.r.t. group.
+   *
+   * @param V 3 x N matrix of vectors
+   * @return 3 x 3N matrix with horizontally stacked blocks \f$ \mathrm{d}^r (X v_i)_X \f$
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    const Eigen::Matrix3<Scalar> R = Base::matrix();
+    Eigen::Matrix<Scalar, 3, -1> ret(3, 3 * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      ret.template middleCols<3>(3 * i).noalias() = -R * Base::hat(V.col(i));
+    }
+    return ret;
+  }
+
   /**
    * @brief Project to SO2.
    *
@@ -263,9 +297,241 @@ class Map<const SO3<_Scalar>> : public SO3Base<Map<const SO3<_Scalar>>>
   SMOOTH_CONST_MAP_API();
 };
 
+// \cond
+template<typename _Scalar>
+class SO3Cached;
+// \endcond
+
+// \cond
+template<typename _Scalar>
+struct liebase_info<SO3Cached<_Scalar>> : public liebase_info<SO3<_Scalar>>
+{
+  static constexpr bool is_mutable = false;
+};
+// \endcond
+
+/**
+ * @brief Immutable SO3 storage that caches the rotation matrix.
+ *
+ * Stores the 3x3 rotation matrix alongside the quaternion so that actions, their Jacobians, Ad() and
+ * matrix() do not rebuild it on every call. This costs 9 extra scalars and a matrix computation on
+ * construction, and pays off when the same rotation is applied many times.
+ *
+ * Group operations such as composition and inverse return plain SO3 objects.
+ *
+ * @see SO3Base for group API.
+ */
+template<typename _Scalar>
+class SO3Cached : public SO3Base<SO3Cached<_Scalar>>
+{
+  using Base = SO3Base<SO3Cached<_Scalar>>;
+
+public:
+  SMOOTH_INHERIT_TYPEDEFS;
+
+  /// @brief Matrix Lie group type.
+  using Matrix = typename Base::Matrix;
+  /// @brief Tangent map type.
+  using TangentMap = typename Base::TangentMap;
+
+  /// @brief Underlying storage is an Eigen matrix
+  using Storage = Eigen::Matrix<Scalar, RepSize, 1>;
+
+  /**
+   * @brief Construct identity element.
+   */
+  SO3Cached() : m_coeffs(Scalar(0), Scalar(0), Scalar(0), Scalar(1)), m_R(Matrix::Identity()) {}
+
+  /**
+   * @brief Construct from other SO3 storage type.
+   */
+  template<typename OtherDerived>
+  SO3Cached(const SO3Base<OtherDerived> & o) noexcept
+      : m_coeffs(static_cast<const OtherDerived &>(o).coeffs()), m_R(o.quat().toRotationMatrix())
+  {}
+
+  /**
+   * @brief Construct from quaternion.
+   *
+   * @note Input is normalized inside constructor.
+   */
+  template<typename Derived>
+  explicit SO3Cached(const Eigen::QuaternionBase<Derived> & quat) : SO3Cached(SO3<Scalar>(quat))
+  {}
+
+  /// @brief Const access underlying Eigen::Matrix
+  inline const Storage & coeffs() const noexcept { return m_coeffs; }
+  /// @brief Const access raw pointer
+  inline const Scalar * data() const noexcept { return m_coeffs.data(); }
+
+  /**
+   * @brief Cached rotation matrix.
+   */
+  const Matrix & matrix() const noexcept { return m_R; }
+
+  /**
+   * @brief Group adjoint (equal to the rotation matrix).
+   */
+  TangentMap Ad() const noexcept { return m_R; }
+
+  /**
+   * @brief Rotation action on 3D vector.
+   */
+  template<typename EigenDerived>
+  Eigen::Vector3<Scalar> operator*(const Eigen::MatrixBase<EigenDerived> & v) const
+  {
+    return m_R * v;
+  }
+
+  /**
+   * @brief Jacobian of rotation action w.r.t. group.
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix3<Scalar> dr_action(const Eigen::MatrixBase<EigenDerived> & v) const
+  {
+    return -m_R * Base::hat(v);
+  }
+
+  /**
+   * @brief Rotation action on a batch of 3D vectors.
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, EigenDerived::ColsAtCompileTime>
+  action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    return m_R * V;
+  }
+
+  /**
+   * @brief Jacobians of rotation action on a batch of 3D vectors w.r.t. group.
+   */
+  template<typename EigenDerived>
+  Eigen::Matrix<Scalar, 3, -1> dr_action_batch(const Eigen::MatrixBase<EigenDerived> & V) const
+  {
+    Eigen::Matrix<Scalar, 3, -1> ret(3, 3 * V.cols());
+    for (Eigen::Index i = 0; i < V.cols(); ++i) {
+      ret.template middleCols<3>(3 * i).noalias() = -m_R * Base::hat(V.col(i));
+    }
+    return ret;
+  }
+
+private:
+  Storage m_coeffs;
+  Matrix m_R;
+};
+
+/**
+ * @brief Accumulator for long chains of SO3 compositions with lazy renormalization.
+ *
+ * Composing many rotations (e.g. when integrating gyroscope measurements) lets the quaternion norm
+ * drift due to rounding. SO3 composition canonicalizes the sign on every product, and normalizing on
+ * every step would add a square root and a division. This accumulator instead keeps a conservative
+ * bound on the drift \f$ | \|q\|^2 - 1 | \f$ that is updated with a single addition per step, and
+ * only measures and corrects the norm once the bound exceeds a tolerance.
+ *
+ * Provided that all composed elements are valid SO3 elements, the stored quaternion satisfies
+ * \f$ | \|q\|^2 - 1 | \leq tol \f$ at all times. The quaternion sign is canonicalized in value().
+ */
+template<typename _Scalar>
+class SO3Accumulator
+{
+public:
+  /// @brief Scalar type.
+  using Scalar = _Scalar;
+
+  /// @brief Default drift tolerance on the squared norm.
+  static Scalar default_tol() { return Scalar(1000) * Eigen::NumTraits<Scalar>::epsilon(); }
+
+  /**
+   * @brief Construct accumulator at identity.
+   *
+   * @param tol tolerance on \f$ | \|q\|^2 - 1 | \f$, must be larger than \f$ 16 \epsilon \f$.
+   */
+  explicit SO3Accumulator(const Scalar & tol = default_tol()) : m_q(Eigen::Quaternion<Scalar>::Identity()), m_tol(tol)
+  {}
+
+  /**
+   * @brief Construct accumulator at an initial rotation.
+   *
+   * @param g initial rotation.
+   * @param tol tolerance on \f$ | \|q\|^2 - 1 | \f$, must be larger than \f$ 16 \epsilon \f$.
+   */
+  template<typename Derived>
+  explicit SO3Accumulator(const SO3Base<Derived> & g, const Scalar & tol = default_tol()) : m_q(g.quat()), m_tol(tol)
+  {}
+
+  /**
+   * @brief Right-compose with a rotation, i.e. set \f$ q \leftarrow q \otimes g \f$.
+   */
+  template<typename Derived>
+  SO3Accumulator & operator*=(const SO3Base<Derived> & g)
+  {
+    m_q = m_q * g.quat();
+    update_drift();
+    return *this;
+  }
+
+  /**
+   * @brief Right-compose with the exponential of a tangent, i.e. set \f$ q \leftarrow q \otimes \exp(a) \f$.
+   */
+  template<typename Derived>
+  SO3Accumulator & operator+=(const Eigen::MatrixBase<Derived> & a)
+  {
+    return *this *= SO3<Scalar>::exp(a);
+  }
+
+  /**
+   * @brief Current value as an SO3 element with canonical sign.
+   */
+  SO3<Scalar> value() const
+  {
+    SO3<Scalar> ret;
+    ret.coeffs() = m_q.coeffs();
+    if (ret.coeffs()(3) < Scalar(0)) { ret.coeffs() *= Scalar(-1); }
+    return ret;
+  }
+
+  /**
+   * @brief Current upper bound on \f$ | \|q\|^2 - 1 | \f$.
+   */
+  const Scalar & drift_bound() const { return m_drift; }
+
+  /**
+   * @brief Number of renormalizations performed so far.
+   */
+  std::size_t renormalizations() const { return m_renormalizations; }
+
+private:
+  /// @brief Conservative squared-norm drift added by one product of (near) unit quaternions.
+  static Scalar step_drift() { return Scalar(16) * Eigen::NumTraits<Scalar>::epsilon(); }
+
+  void update_drift()
+  {
+    m_drift += step_drift();
+    if (m_drift > m_tol) {
+      // one Newton step for 1 / sqrt(n2) around 1, leaves an O((n2 - 1)^2) error
+      const Scalar n2 = m_q.squaredNorm();
+      m_q.coeffs() *= (Scalar(3) - n2) / Scalar(2);
+      m_drift = step_drift();
+      ++m_renormalizations;
+    }
+  }
+
+  Eigen::Quaternion<Scalar> m_q;
+  Scalar m_tol;
+  Scalar m_drift{0};
+  std::size_t m_renormalizations{0};
+};
+
 using SO3f = SO3<float>;   ///< SO3 with float scalar representation
 using SO3d = SO3<double>;  ///< SO3 with double scalar representation
 
+using SO3Cachedf = SO3Cached<float>;   ///< SO3Cached with float scalar representation
+using SO3Cachedd = SO3Cached<double>;  ///< SO3Cached with double scalar representation
+
+using SO3Accumulatorf = SO3Accumulator<float>;   ///< SO3Accumulator with float scalar representation
+using SO3Accumulatord = SO3Accumulator<double>;  ///< SO3Accumulator with double scalar representation
+
 SMOOTH_END_NAMESPACE
 
 // Std format
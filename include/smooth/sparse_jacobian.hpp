@@ -0,0 +1,314 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "smooth/version.hpp"
+
+/**
+ * @file
+ * @brief Sparse matrix builder with a cached sparsity pattern.
+ *
+ * The pattern is registered once as a collection of non-overlapping blocks and compiled into a
+ * compressed sparse matrix. After that, block values are written directly into the compressed
+ * value storage without any allocation or index search.
+ *
+ * Example:
+ * @code
+ * SparseJacobianBuilder<double> builder(12, 12);
+ * const auto b0 = builder.add_block(0, 0, 6, 6);                               // dense block
+ * const auto b1 = builder.add_pattern(6, 6, d_exp_sparse_pattern<SE3d>);       // sparse block
+ * builder.compile();
+ *
+ * auto sp = d_exp_sparse_pattern<SE3d>;  // local copy of pattern
+ * for (...) {
+ *   builder.set_block(b0, A);             // A is a 6x6 matrix
+ *   dr_exp_sparse<SE3d>(sp, a);
+ *   builder.set_block(b1, sp);
+ *   use(builder.matrix());
+ * }
+ * @endcode
+ */
+
+SMOOTH_BEGIN_NAMESPACE
+
+/**
+ * @brief Sparse (jacobian) matrix with a fixed block structure.
+ *
+ * @tparam Scalar scalar type
+ * @tparam Options storage order of the resulting matrix (Eigen::ColMajor or Eigen::RowMajor)
+ *
+ * Writing to different blocks via set_block() from different threads is safe.
+ */
+template<typename Scalar = double, int Options = Eigen::ColMajor>
+class SparseJacobianBuilder
+{
+public:
+  /// @brief Resulting sparse matrix type.
+  using Matrix = Eigen::SparseMatrix<Scalar, Options>;
+
+  /// @brief Block identifier returned by add_block() and add_pattern().
+  using BlockId = std::size_t;
+
+  /// @brief Construct an empty builder for a rows x cols matrix.
+  explicit SparseJacobianBuilder(Eigen::Index rows = 0, Eigen::Index cols = 0) : m_rows(rows), m_cols(cols) {}
+
+  /// @brief Number of rows.
+  Eigen::Index rows() const { return m_rows; }
+
+  /// @brief Number of columns.
+  Eigen::Index cols() const { return m_cols; }
+
+  /// @brief Number of registered blocks.
+  std::size_t num_blocks() const { return m_blocks.size(); }
+
+  /// @brief True if compile() has been called since the last change of the pattern.
+  bool compiled() const { return m_compiled; }
+
+  /**
+   * @brief Remove all blocks and resize.
+   */
+  void reset(Eigen::Index rows, Eigen::Index cols)
+  {
+    m_rows = rows;
+    m_cols = cols;
+    m_blocks.clear();
+    m_triplets.clear();
+    m_pos.clear();
+    m_mat      = Matrix();
+    m_compiled = false;
+  }
+
+  /**
+   * @brief Register a dense block.
+   *
+   * @param row first row of block
+   * @param col first column of block
+   * @param nrows number of rows in block
+   * @param ncols number of columns in block
+   *
+   * @return identifier to use with set_block()
+   *
+   * @note Blocks must not overlap.
+   */
+  BlockId add_block(Eigen::Index row, Eigen::Index col, Eigen::Index nrows, Eigen::Index ncols)
+  {
+    assert(0 <= row && row + nrows <= m_rows);
+    assert(0 <= col && col + ncols <= m_cols);
+
+    for (Eigen::Index j = 0; j < ncols; ++j) {
+      for (Eigen::Index i = 0; i < nrows; ++i) { m_triplets.emplace_back(row + i, col + j, Scalar(0)); }
+    }
+    m_blocks.push_back(Block{row, col, nrows, ncols, -1, false, 0});
+    m_compiled = false;
+    return m_blocks.size() - 1;
+  }
+
+  /**
+   * @brief Register a block with a sparsity pattern.
+   *
+   * @param row first row of block
+   * @param col first column of block
+   * @param pattern sparse matrix whose (structural) non-zeros define the block pattern
+   *
+   * @return identifier to use with set_block()
+   *
+   * @note Blocks must not overlap.
+   */
+  template<int PatternOptions>
+  BlockId add_pattern(Eigen::Index row, Eigen::Index col, const Eigen::SparseMatrix<Scalar, PatternOptions> & pattern)
+  {
+    assert(0 <= row && row + pattern.rows() <= m_rows);
+    assert(0 <= col && col + pattern.cols() <= m_cols);
+
+    Eigen::Index nnz = 0;
+    for (Eigen::Index o = 0; o < pattern.outerSize(); ++o) {
+      for (typename Eigen::SparseMatrix<Scalar, PatternOptions>::InnerIterator it(pattern, o); it; ++it, ++nnz) {
+        m_triplets.emplace_back(row + it.row(), col + it.col(), Scalar(0));
+      }
+    }
+    m_blocks.push_back(Block{row, col, pattern.rows(), pattern.cols(), nnz, true, 0});
+    m_compiled = false;
+    return m_blocks.size() - 1;
+  }
+
+  /**
+   * @brief Allocate the sparse matrix and compute value positions of all blocks.
+   *
+   * All values are set to zero.
+   */
+  void compile()
+  {
+    m_mat.resize(m_rows, m_cols);
+    m_mat.setFromTriplets(m_triplets.begin(), m_triplets.end());
+    m_mat.makeCompressed();
+
+    // duplicates are summed by setFromTriplets, so overlapping blocks result in fewer non-zeros
+    assert(m_mat.nonZeros() == static_cast<Eigen::Index>(m_triplets.size()) && "Blocks must not overlap");
+
+    m_pos.clear();
+    auto trip_it = m_triplets.cbegin();
+    for (auto & block : m_blocks) {
+      block.pos0 = m_pos.size();
+      if (block.is_pattern) {
+        // one position per non-zero
+        for (Eigen::Index k = 0; k < block.nnz; ++k, ++trip_it) {
+          m_pos.push_back(find(trip_it->row(), trip_it->col()));
+        }
+      } else {
+        // one position per outer index, inner indices are contiguous since blocks do not overlap
+        if constexpr (Matrix::IsRowMajor) {
+          for (Eigen::Index i = 0; i < block.nrows; ++i) { m_pos.push_back(find(block.row + i, block.col)); }
+        } else {
+          for (Eigen::Index j = 0; j < block.ncols; ++j) { m_pos.push_back(find(block.row, block.col + j)); }
+        }
+        trip_it += block.nrows * block.ncols;
+      }
+    }
+
+    m_mat.coeffs().setZero();
+    m_compiled = true;
+  }
+
+  /**
+   * @brief Set all values to zero without changing the pattern.
+   */
+  void setZero()
+  {
+    assert(m_compiled);
+    m_mat.coeffs().setZero();
+  }
+
+  /**
+   * @brief Write values of a dense block.
+   *
+   * @param id block identifier returned by add_block()
+   * @param values dense matrix with the same size as the block
+   */
+  template<typename Derived>
+  void set_block(BlockId id, const Eigen::MatrixBase<Derived> & values)
+  {
+    set_block(m_mat, id, values);
+  }
+
+  /**
+   * @brief Write values of a dense block into a copy of matrix().
+   *
+   * Does not modify the builder, so several threads can fill their own copies concurrently.
+   *
+   * @param mat matrix with the compiled pattern (e.g. a copy of matrix())
+   * @param id block identifier returned by add_block()
+   * @param values dense matrix with the same size as the block
+   */
+  template<typename Derived>
+  void set_block(Matrix & mat, BlockId id, const Eigen::MatrixBase<Derived> & values) const
+  {
+    assert(m_compiled);
+    assert(id < m_blocks.size());
+    assert(mat.nonZeros() == m_mat.nonZeros());
+
+    const Block & block = m_blocks[id];
+
+    assert(!block.is_pattern);
+    assert(values.rows() == block.nrows && values.cols() == block.ncols);
+
+    Scalar * const vals = mat.valuePtr();
+    const auto * pos    = m_pos.data() + block.pos0;
+
+    if constexpr (Matrix::IsRowMajor) {
+      for (Eigen::Index i = 0; i < block.nrows; ++i) {
+        Eigen::Map<Eigen::Matrix<Scalar, 1, -1>>(vals + pos[i], block.ncols) = values.row(i);
+      }
+    } else {
+      for (Eigen::Index j = 0; j < block.ncols; ++j) {
+        Eigen::Map<Eigen::Matrix<Scalar, -1, 1>>(vals + pos[j], block.nrows) = values.col(j);
+      }
+    }
+  }
+
+  /**
+   * @brief Write values of a pattern block.
+   *
+   * @param id block identifier returned by add_pattern()
+   * @param values sparse matrix with the same pattern as the one given to add_pattern()
+   */
+  template<int PatternOptions>
+  void set_block(BlockId id, const Eigen::SparseMatrix<Scalar, PatternOptions> & values)
+  {
+    set_block(m_mat, id, values);
+  }
+
+  /**
+   * @brief Write values of a pattern block into a copy of matrix().
+   *
+   * @param mat matrix with the compiled pattern (e.g. a copy of matrix())
+   * @param id block identifier returned by add_pattern()
+   * @param values sparse matrix with the same pattern as the one given to add_pattern()
+   */
+  template<int PatternOptions>
+  void set_block(Matrix & mat, BlockId id, const Eigen::SparseMatrix<Scalar, PatternOptions> & values) const
+  {
+    assert(m_compiled);
+    assert(id < m_blocks.size());
+    assert(mat.nonZeros() == m_mat.nonZeros());
+
+    const Block & block = m_blocks[id];
+
+    assert(block.is_pattern);
+    assert(values.rows() == block.nrows && values.cols() == block.ncols);
+    assert(values.nonZeros() == block.nnz);
+
+    Scalar * const vals = mat.valuePtr();
+    const auto * pos    = m_pos.data() + block.pos0;
+
+    for (Eigen::Index o = 0; o < values.outerSize(); ++o) {
+      for (typename Eigen::SparseMatrix<Scalar, PatternOptions>::InnerIterator it(values, o); it; ++it, ++pos) {
+        vals[*pos] = it.value();
+      }
+    }
+  }
+
+  /// @brief Compiled sparse matrix.
+  const Matrix & matrix() const
+  {
+    assert(m_compiled);
+    return m_mat;
+  }
+
+private:
+  struct Block
+  {
+    Eigen::Index row, col, nrows, ncols;
+    Eigen::Index nnz;
+    bool is_pattern;
+    std::size_t pos0;
+  };
+
+  /// @brief Position of (row, col) in the value array of m_mat.
+  Eigen::Index find(Eigen::Index row, Eigen::Index col) const
+  {
+    const Eigen::Index outer = Matrix::IsRowMajor ? row : col;
+    const Eigen::Index inner = Matrix::IsRowMajor ? col : row;
+
+    const auto * beg = m_mat.innerIndexPtr() + m_mat.outerIndexPtr()[outer];
+    const auto * end = m_mat.innerIndexPtr() + m_mat.outerIndexPtr()[outer + 1];
+    const auto * it  = std::lower_bound(beg, end, inner);
+    assert(it != end && *it == inner);
+    return static_cast<Eigen::Index>(it - m_mat.innerIndexPtr());
+  }
+
+  Eigen::Index m_rows, m_cols;
+  std::vector<Block> m_blocks;
+  std::vector<Eigen::Triplet<Scalar, Eigen::Index>> m_triplets;
+  std::vector<Eigen::Index> m_pos;
+  Matrix m_mat;
+  bool m_compiled{false};
+};
+
+SMOOTH_END_NAMESPACE
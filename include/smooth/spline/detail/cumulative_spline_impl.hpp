@@ -105,11 +105,12 @@ SplineJacobian<G, K - 1> cspline_eval_dg_dvs(
     const Scalar<G> dBj  = duvec.dot(Bcum.col(j));
     const Scalar<G> d2Bj = d2uvec.dot(Bcum.col(j));
 
-    const TangentMap<G> Adj   = Ad(::smooth::exp<G>(-Bj * vj));
-    const TangentMap<G> DrExp = dr_exp<G>(-Bj * vj);
+    const auto [ExpInv, DrExp] = exp_with_dr_exp<G>(-Bj * vj);
+    const TangentMap<G> Adj    = Ad(ExpInv);
 
+    // dr_exp(a) = Ad_{exp(-a)} dr_exp(-a)
     dg_dvs.leftCols((j - 1) * Dof<G>).applyOnTheLeft(Adj);
-    dg_dvs.template middleCols<Dof<G>>((j - 1) * Dof<G>) += Bj * dr_exp<G>(Bj * vj);
+    dg_dvs.template middleCols<Dof<G>>((j - 1) * Dof<G>).noalias() += Bj * Adj * DrExp;
 
     if (dvel_dvs.has_value() || dacc_dvs.has_value()) {
       dvel_dvs->leftCols((j - 1) * Dof<G>).applyOnTheLeft(Adj);
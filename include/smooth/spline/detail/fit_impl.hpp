@@ -11,6 +11,7 @@
 
 #include "../../manifolds/vector.hpp"
 #include "../../optim.hpp"
+#include "../../sparse_jacobian.hpp"
 #include "../fit.hpp"
 
 SMOOTH_BEGIN_NAMESPACE
@@ -249,13 +250,13 @@ auto fit_spline(
     V.row(k)           = fit_spline_1d(dts, dgs | transform([k](const auto & v) { return v(k); }), ss_proj);
   }
 
-  Spline<K, G> ret;
-  ret.reserve(N);
+  std::vector<Eigen::Matrix<double, Dof<G>, K>> Vs;
+  Vs.reserve(N - 1);
 
-  for (const auto & [i, dt, g, g_next] : utils::zip(iota(0u), dts, gs, gs | drop(1))) {
+  for (const auto & [i, g, g_next] : utils::zip(iota(0u, N - 1), gs, gs | drop(1))) {
     // spline is in cumulative form, need to get cumulative coefficients
-    Eigen::Matrix<double, Dof<G>, K> cum_coefs =
-      V.template block<Dof<G>, K>(0, i * (K + 1) + 1) - V.template block<Dof<G>, K>(0, i * (K + 1));
+    auto & cum_coefs =
+      Vs.emplace_back(V.template block<Dof<G>, K>(0, i * (K + 1) + 1) - V.template block<Dof<G>, K>(0, i * (K + 1)));
 
     if constexpr (K > 2) {
       // modify segment to ensure it is interpolating
@@ -267,13 +268,9 @@ auto fit_spline(
       for (auto k = K - 1; k > mid; --k) { midval = composition<G>(midval, ::smooth::exp<G>(-cum_coefs.col(k))); }
       cum_coefs.col(mid) = ::smooth::log<G>(midval);
     }
-
-    ret.concat_global(Spline<K, G>(dt, std::move(cum_coefs), g));
   }
 
-  ret.concat_global(gs[N - 1]);
-
-  return ret;
+  return Spline<K, G>(dts | take(int64_t(N - 1)), gs | take(int64_t(N)), std::move(Vs));
 }
 
 auto fit_spline_cubic(std::ranges::range auto && ts, std::ranges::range auto && gs)
@@ -302,6 +299,8 @@ struct fit_bspline_objective
 
   Eigen::Index NumData, NumPts;
 
+  SparseJacobianBuilder<double> Jac;
+
   static constexpr auto M_s = polynomial_cumulative_basis<PolynomialBasis::Bspline, K>();
   inline static const Eigen::Map<const Eigen::Matrix<double, K + 1, K + 1, Eigen::RowMajor>> M =
     Eigen::Map<const Eigen::Matrix<double, K + 1, K + 1, Eigen::RowMajor>>(M_s[0].data());
@@ -318,6 +317,14 @@ struct fit_bspline_objective
 
     NumData = static_cast<Eigen::Index>(std::min(std::ranges::size(ts), std::ranges::size(gs)));
     NumPts  = static_cast<Eigen::Index>(K + static_cast<Eigen::Index>((t1 - t0 + dt) / dt));
+
+    // jacobian pattern only depends on ts: one block per data point
+    Jac.reset(Dof<G> * NumData, Dof<G> * NumPts);
+    for (const auto & [i, t] : utils::zip(std::views::iota(0u), ts | std::views::take(NumData))) {
+      const int64_t istar = static_cast<int64_t>((t - t0) / dt);
+      Jac.add_block(i * Dof<G>, istar * Dof<G>, Dof<G>, Dof<G> * (K + 1));
+    }
+    Jac.compile();
   }
 
   /// @brief Objective function
@@ -345,9 +352,8 @@ struct fit_bspline_objective
   {
     using namespace std::views;
 
-    Eigen::SparseMatrix<double, Eigen::RowMajor> Jac;
-    Jac.resize(Dof<G> * NumData, Dof<G> * NumPts);
-    Jac.reserve(Eigen::Matrix<int, -1, 1>::Constant(Dof<G> * NumData, Dof<G> * (K + 1)));
+    // copy of the compiled pattern, only values are written below
+    Eigen::SparseMatrix<double> ret = Jac.matrix();
 
     for (const auto & [i, t, gi] : utils::zip(iota(0u), ts, gs)) {
       const int64_t istar = static_cast<int64_t>((t - t0) / dt);
@@ -357,21 +363,16 @@ struct fit_bspline_objective
       const auto g      = cspline_eval_gs<K>(var | drop(istar) | take(int64_t(K + 1)), M, u);
       const auto dg_dgs = cspline_eval_dg_dgs<K>(var | drop(istar) | take(int64_t(K + 1)), M, u);
 
-      const Tangent<G> resi = rminus(g, gi);
+      // residual is rminus(g, gi), only its jacobian is needed here
+      const Eigen::Matrix<double, Dof<G>, Dof<G>> d_resi_vali =
+        log_with_dr_expinv(composition(inverse(gi), g)).second;
 
-      const Eigen::Matrix<double, Dof<G>, Dof<G>> d_resi_vali          = dr_expinv<G>(resi);
       const Eigen::Matrix<double, Dof<G>, (K + 1) * Dof<G>> d_resi_pts = d_resi_vali * dg_dgs;
 
-      for (auto r = 0u; r != Dof<G>; ++r) {
-        for (auto c = 0u; c != Dof<G> * (K + 1); ++c) {
-          Jac.insert(i * Dof<G> + r, istar * Dof<G> + c) = d_resi_pts(r, c);
-        }
-      }
+      Jac.set_block(ret, i, d_resi_pts);
     }
 
-    Jac.makeCompressed();
-
-    return Jac;
+    return ret;
   }
 };
 
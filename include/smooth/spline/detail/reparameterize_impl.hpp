@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cassert>
+#include <vector>
 
 #include "../../external/lp2d.hpp"
 #include "../reparameterize.hpp"
@@ -114,8 +115,11 @@ Spline<2, double> reparameterize_spline(
 
   // FORWARD PASS WITH MAXIMAL REPARAMETERIZATION ACCELERATION
 
-  Spline<2, double> ret;
-  ret.reserve(N + 1);
+  std::vector<double> seg_dt, seg_s;
+  std::vector<Eigen::Matrix<double, 1, 2>> seg_V;
+  seg_dt.reserve(N);
+  seg_s.reserve(N + 1);
+  seg_V.reserve(N);
 
   // "current" squared velocity
   double v2m = std::min(start_vel * start_vel, v2max(0));
@@ -149,11 +153,9 @@ Spline<2, double> reparameterize_spline(
       const double dt = std::abs(ai) < eps ? ds / vi : (-vi + std::sqrt(std::max<double>(eps, vi2 + 2 * ds * ai))) / ai;
 
       // add segment to spline
-      ret.concat_global(Spline<2, double>{
-        dt,
-        Eigen::Vector2d{dt * vi / 2, dt * (dt * ai + vi) / 2},
-        si,
-      });
+      seg_dt.push_back(dt);
+      seg_s.push_back(si);
+      seg_V.push_back(Eigen::Matrix<double, 1, 2>{dt * vi / 2, dt * (dt * ai + vi) / 2});
 
       // update squared velocity with value at end of new segment
       v2m = ai == inf ? vi2 : std::max<double>(eps, vi2 + 2 * ai * ds);
@@ -161,9 +163,9 @@ Spline<2, double> reparameterize_spline(
   }
 
   // reparameterization attains t_max
-  ret.concat_global(Spline<2, double>(spline.t_max()));
+  seg_s.push_back(spline.t_max());
 
-  return ret;
+  return Spline<2, double>(seg_dt, seg_s, std::move(seg_V));
 }
 
 SMOOTH_END_NAMESPACE
@@ -4,9 +4,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <functional>
 
 #include <Eigen/Core>
 
+#include "../../detail/parallel.hpp"
 #include "../../polynomial/basis.hpp"
 #include "../cumulative_spline.hpp"
 #include "../spline.hpp"
@@ -23,12 +25,13 @@ inline static const Eigen::Map<const Eigen::Matrix<double, K + 1, K + 1, Eigen::
   Eigen::Map<const Eigen::Matrix<double, K + 1, K + 1, Eigen::RowMajor>>(kBasisFunction<K>[0].data());
 
 template<int K, LieGroup G>
-Spline<K, G>::Spline(const G & ga) : m_g0{ga}, m_end_t{}, m_end_g{}, m_Vs{}, m_seg_T0{}, m_seg_Del{}
+Spline<K, G>::Spline(const G & ga) : m_g0{ga}, m_end_t{}, m_end_g{}, m_Vs{}, m_seg_T0{}, m_seg_Del{}, m_seg_comp{}
 {}
 
 template<int K, LieGroup G>
 Spline<K, G>::Spline(double T, Eigen::Matrix<double, Dof<G>, K> && V, G && ga)
-    : m_g0{std::move(ga)}, m_end_t{T}, m_Vs{{std::move(V)}}, m_seg_T0{0}, m_seg_Del{1}
+    : m_g0{std::move(ga)}, m_end_t{T}, m_Vs{{std::move(V)}}, m_seg_T0{0}, m_seg_Del{1},
+      m_seg_comp{Identity<G>()}
 {
   assert(T > 0);
 
@@ -38,6 +41,8 @@ Spline<K, G>::Spline(double T, Eigen::Matrix<double, Dof<G>, K> && V, G && ga)
   } else {
     m_end_g[0] = composition(m_g0, cspline_eval_vs<K, G>(m_Vs[0].colwise(), kMappedBasisFunction<K>, 1.));
   }
+
+  update_arclength(0);
 }
 
 template<int K, LieGroup G>
@@ -49,7 +54,8 @@ Spline<K, G>::Spline(double T, const Eigen::MatrixBase<Derived> & V, const G & g
 template<int K, LieGroup G>
 template<std::ranges::range Rv>
   requires(std::is_same_v<std::ranges::range_value_t<Rv>, Tangent<G>>)
-Spline<K, G>::Spline(double T, const Rv & vs, const G & ga) : m_g0(ga), m_end_t{T}, m_seg_T0{0}, m_seg_Del{1}
+Spline<K, G>::Spline(double T, const Rv & vs, const G & ga)
+    : m_g0(ga), m_end_t{T}, m_seg_T0{0}, m_seg_Del{1}, m_seg_comp{Identity<G>()}
 {
   assert(T > 0);
   assert(std::ranges::size(vs) == K);
@@ -63,6 +69,41 @@ Spline<K, G>::Spline(double T, const Rv & vs, const G & ga) : m_g0(ga), m_end_t{
   } else {
     m_end_g[0] = composition(m_g0, cspline_eval_vs<K, G>(m_Vs[0].colwise(), kMappedBasisFunction<K>, 1.));
   }
+
+  update_arclength(0);
+}
+
+template<int K, LieGroup G>
+template<std::ranges::input_range Rt, std::ranges::input_range Rg>
+  requires(std::is_convertible_v<std::ranges::range_value_t<Rg>, G>)
+Spline<K, G>::Spline(const Rt & dts, const Rg & gs, std::vector<Eigen::Matrix<double, Dof<G>, K>> && Vs)
+    : m_Vs(std::move(Vs))
+{
+  const std::size_t N = m_Vs.size();
+
+  m_end_t.reserve(N);
+  for (double t = 0; const auto & dt : dts) {
+    assert(dt > 0);
+    t += dt;
+    m_end_t.push_back(t);
+  }
+  assert(m_end_t.size() == N);
+
+  m_end_g.reserve(N);
+  for (auto i = 0u; const auto & g : gs) {
+    if (i++ == 0) {
+      m_g0 = g;
+    } else {
+      m_end_g.push_back(g);
+    }
+  }
+  assert(m_end_g.size() == N);
+
+  m_seg_T0.assign(N, 0);
+  m_seg_Del.assign(N, 1);
+  m_seg_comp.assign(N, Identity<G>());
+
+  update_arclength(0);
 }
 
 template<int K, LieGroup G>
@@ -115,6 +156,8 @@ void Spline<K, G>::reserve(std::size_t capacity)
   m_Vs.reserve(capacity);
   m_seg_T0.reserve(capacity);
   m_seg_Del.reserve(capacity);
+  m_seg_comp.reserve(capacity);
+  m_seg_arclen.reserve(capacity);
 }
 
 template<int K, LieGroup G>
@@ -168,13 +211,21 @@ Spline<K, G> & Spline<K, G>::concat_global(const Spline & other)
   m_Vs.resize(N1 + N2);
   m_seg_T0.resize(N1 + N2);
   m_seg_Del.resize(N1 + N2);
+  m_seg_comp.resize(N1 + N2);
 
   for (auto i = 0u; i < N2; ++i) {
-    m_end_t[N1 + i]   = tend + other.m_end_t[i];
-    m_end_g[N1 + i]   = other.m_end_g[i];
-    m_Vs[N1 + i]      = other.m_Vs[i];
-    m_seg_T0[N1 + i]  = other.m_seg_T0[i];
-    m_seg_Del[N1 + i] = other.m_seg_Del[i];
+    m_end_t[N1 + i]    = tend + other.m_end_t[i];
+    m_end_g[N1 + i]    = other.m_end_g[i];
+    m_Vs[N1 + i]       = other.m_Vs[i];
+    m_seg_T0[N1 + i]   = other.m_seg_T0[i];
+    m_seg_Del[N1 + i]  = other.m_seg_Del[i];
+    m_seg_comp[N1 + i] = other.m_seg_comp[i];
+  }
+
+  if constexpr (K <= 3) {
+    const Tangent<G> arclen0 = N1 == 0 ? Tangent<G>::Zero() : m_seg_arclen[N1 - 1];
+    m_seg_arclen.resize(N1 + N2);
+    for (auto i = 0u; i < N2; ++i) { m_seg_arclen[N1 + i] = arclen0 + other.m_seg_arclen[i]; }
   }
 
   return *this;
@@ -200,13 +251,21 @@ Spline<K, G> & Spline<K, G>::concat_local(const Spline & other)
   m_Vs.resize(N1 + N2);
   m_seg_T0.resize(N1 + N2);
   m_seg_Del.resize(N1 + N2);
+  m_seg_comp.resize(N1 + N2);
 
   for (auto i = 0u; i < N2; ++i) {
-    m_end_t[N1 + i]   = tend + other.m_end_t[i];
-    m_end_g[N1 + i]   = composition(gend, other.m_end_g[i]);
-    m_Vs[N1 + i]      = other.m_Vs[i];
-    m_seg_T0[N1 + i]  = other.m_seg_T0[i];
-    m_seg_Del[N1 + i] = other.m_seg_Del[i];
+    m_end_t[N1 + i]    = tend + other.m_end_t[i];
+    m_end_g[N1 + i]    = composition(gend, other.m_end_g[i]);
+    m_Vs[N1 + i]       = other.m_Vs[i];
+    m_seg_T0[N1 + i]   = other.m_seg_T0[i];
+    m_seg_Del[N1 + i]  = other.m_seg_Del[i];
+    m_seg_comp[N1 + i] = other.m_seg_comp[i];
+  }
+
+  if constexpr (K <= 3) {
+    const Tangent<G> arclen0 = N1 == 0 ? Tangent<G>::Zero() : m_seg_arclen[N1 - 1];
+    m_seg_arclen.resize(N1 + N2);
+    for (auto i = 0u; i < N2; ++i) { m_seg_arclen[N1 + i] = arclen0 + other.m_seg_arclen[i]; }
   }
 
   return *this;
@@ -240,15 +299,21 @@ CastT<S, G> Spline<K, G>::operator()(const S & t, OptTangent<CastT<S, G>> vel, O
     return cast<S>(m_end_g.back());
   }
 
-  const auto istar = find_idx(static_cast<double>(t));
+  return eval_segment(find_idx(static_cast<double>(t)), t, vel, acc);
+}
 
+template<int K, LieGroup G>
+template<typename S>
+CastT<S, G> Spline<K, G>::eval_segment(
+  std::size_t istar, const S & t, OptTangent<CastT<S, G>> vel, OptTangent<CastT<S, G>> acc) const
+{
   const double ta = istar == 0 ? 0 : m_end_t[istar - 1];
   const double T  = m_end_t[istar] - ta;
 
   const double Del = m_seg_Del[istar];
   const S u        = std::clamp<S>(S(m_seg_T0[istar]) + S(Del) * (t - S(ta)) / S(T), S(0.), S(1.));
 
-  G g0 = istar == 0 ? m_g0 : m_end_g[istar - 1];
+  const G g0 = segment_start(istar);
 
   if constexpr (K == 0) {
     // piecewise constant, nothing to evaluate
@@ -256,11 +321,6 @@ CastT<S, G> Spline<K, G>::operator()(const S & t, OptTangent<CastT<S, G>> vel, O
     if (acc.has_value()) { acc.value().setZero(); }
     return g0;
   } else {
-    // compensate for cropped intervals
-    if (m_seg_T0[istar] > 0) {
-      g0 = composition(
-        g0, inverse(cspline_eval_vs<K, G>(m_Vs[istar].colwise(), kMappedBasisFunction<K>, m_seg_T0[istar])));
-    }
     const CastT<S, G> add = cspline_eval_vs<K, CastT<S, G>>(
       m_Vs[istar].template cast<S>().colwise(), kMappedBasisFunction<K>.template cast<S>(), u, vel, acc);
     if (vel.has_value()) { vel.value() *= S(Del / T); }
@@ -269,32 +329,115 @@ CastT<S, G> Spline<K, G>::operator()(const S & t, OptTangent<CastT<S, G>> vel, O
   }
 }
 
+template<int K, LieGroup G>
+template<std::ranges::random_access_range Rt>
+  requires(std::ranges::sized_range<Rt>)
+void Spline<K, G>::eval(
+  const Rt & ts, std::span<G> gs, std::span<Tangent<G>> vels, std::span<Tangent<G>> accs, std::size_t num_threads) const
+{
+  const auto N = static_cast<std::size_t>(std::ranges::size(ts));
+
+  assert(gs.size() == N);
+  assert(vels.empty() || vels.size() == N);
+  assert(accs.empty() || accs.size() == N);
+
+  const std::size_t C = detail::parallel_num_chunks(N, num_threads, 1024);
+  detail::parallel_for_chunks(N, C, [&](std::size_t b, std::size_t e, std::size_t) {
+    // cursor state for current segment
+    std::size_t istar = size();
+    double ta         = 0;
+
+    for (auto k = b; k < e; ++k) {
+      const double t = std::ranges::begin(ts)[static_cast<std::ptrdiff_t>(k)];
+
+      OptTangent<G> vel = vels.empty() ? OptTangent<G>{} : OptTangent<G>(vels[k]);
+      OptTangent<G> acc = accs.empty() ? OptTangent<G>{} : OptTangent<G>(accs[k]);
+
+      if (empty() || t < 0 || t > t_max()) {
+        gs[k] = operator()(t, vel, acc);
+        continue;
+      }
+
+      // move cursor to segment that contains t
+      if (istar == size() || t < ta) {
+        istar = find_idx(t);
+      } else {
+        while (istar + 1 < size() && t >= m_end_t[istar]) { ++istar; }
+      }
+      ta = istar == 0 ? 0 : m_end_t[istar - 1];
+
+      gs[k] = eval_segment(istar, t, vel, acc);
+    }
+  });
+}
+
 template<int K, LieGroup G>
 Tangent<G> Spline<K, G>::arclength(double t) const
-  requires(K == 3)
+  requires(K <= 3)
 {
-  Tangent<G> ret = Tangent<G>::Zero();
+  if (empty()) { return Tangent<G>::Zero(); }
 
-  for (auto i = 0u; i < m_end_t.size(); ++i) {
-    // check if we have reached t
-    if (i > 0 && t <= m_end_t[i - 1]) { break; }
+  t = std::clamp<double>(t, 0, t_max());
 
-    // polynomial coefficients a0 + a1 x + a2 x2 + a3 x3
-    const Eigen::Matrix<double, K + 1, Dof<G>> coefs = kMappedBasisFunction<K>.rightCols(K) * m_Vs[i].transpose();
+  const auto i = find_idx(t);
 
-    const double ta = i == 0 ? 0 : m_end_t[i - 1];
-    const double tb = m_end_t[i];
+  const double ta = i == 0 ? 0 : m_end_t[i - 1];
+  const double tb = m_end_t[i];
 
-    const double ua = m_seg_T0[i];
-    const double ub = ua + m_seg_Del[i] * (std::min<double>(t, tb) - ta) / (tb - ta);
+  const double ua = m_seg_T0[i];
+  const double ub = ua + m_seg_Del[i] * (t - ta) / (tb - ta);
 
-    for (auto k = 0u; k < Dof<G>; ++k) {
-      // derivative b0 + b1 x + b2 x2 has coefficients [b0, b1, b2] = [a1, 2a2, 3a3]
-      ret(k) += integrate_absolute_polynomial(ua, ub, 3 * coefs(3, k), 2 * coefs(2, k), coefs(1, k));
-    }
+  Tangent<G> ret = segment_arclength(m_Vs[i], ua, ub);
+  if (i > 0) { ret += m_seg_arclen[i - 1]; }
+  return ret;
+}
+
+template<int K, LieGroup G>
+double Spline<K, G>::time_at_arclength(double s, const Tangent<G> & w) const
+  requires(K <= 3)
+{
+  assert((w.array() >= 0).all());
+
+  if (empty() || s <= 0) { return 0; }
+  if (s > w.dot(m_seg_arclen.back())) { return t_max(); }
+
+  // first segment that ends at or after s
+  const auto it =
+    std::ranges::lower_bound(m_seg_arclen, s, std::less<double>{}, [&w](const Tangent<G> & a) { return w.dot(a); });
+  const auto i = static_cast<std::size_t>(std::distance(m_seg_arclen.begin(), it));
+
+  const double si = s - (i == 0 ? 0. : w.dot(m_seg_arclen[i - 1]));
+
+  const double ta = i == 0 ? 0 : m_end_t[i - 1];
+  const double tb = m_end_t[i];
+
+  const double ua  = m_seg_T0[i];
+  const double Del = m_seg_Del[i];
+
+  // coefficients b0 + b1 x + b2 x2 of segment velocity
+  Eigen::Matrix<double, 4, Dof<G>> coefs    = Eigen::Matrix<double, 4, Dof<G>>::Zero();
+  coefs.template topRows<K + 1>()           = kMappedBasisFunction<K>.rightCols(K) * m_Vs[i].transpose();
+  const Eigen::Matrix<double, 3, Dof<G>> b = Eigen::Vector3d(1, 2, 3).asDiagonal() * coefs.template bottomRows<3>();
+
+  // safeguarded Newton iteration for the smallest u in [ua, ua + Del] with w' A(u) >= si,
+  // the bracket is maintained such that w' A(lo) < si <= w' A(hi)
+  double lo = ua, hi = ua + Del, u = ua + Del / 2;
+  for (auto iter = 0u; iter < 100 && hi - lo > 1e-14; ++iter) {
+    const double f = w.dot(segment_arclength(m_Vs[i], ua, u)) - si;
+
+    const Eigen::Vector3d U(1, u, u * u);
+    const double df = w.dot((b.transpose() * U).cwiseAbs());
+
+    // arclength is strictly increasing at u, so there is no smaller root
+    if (std::abs(f) < 1e-12 && df > 0) { return ta + (tb - ta) * (u - ua) / Del; }
+
+    (f < 0 ? lo : hi) = u;
+
+    const double u_newton = df > 0 ? u - f / df : lo - 1;
+    u                     = (lo < u_newton && u_newton < hi) ? u_newton : (lo + hi) / 2;
   }
 
-  return ret;
+  return ta + (tb - ta) * (hi - ua) / Del;
 }
 
 template<int K, LieGroup G>
@@ -303,7 +446,7 @@ Spline<K, G> Spline<K, G>::crop(double ta, double tb, bool localize) const
   ta = std::max<double>(ta, 0);
   tb = std::min<double>(tb, t_max());
 
-  if (tb <= ta) { return Spline(); }
+  if (tb <= ta) { return Spline(localize ? Identity<G>() : operator()(ta)); }
 
   const std::size_t i0 = find_idx(ta);
   std::size_t Nseg     = find_idx(tb) + 1 - i0;
@@ -316,28 +459,33 @@ Spline<K, G> Spline<K, G>::crop(double ta, double tb, bool localize) const
   // state at new from beginning of Spline
   G ga = operator()(ta);
 
+  // transformation to new frame
+  const G ga_inv = localize ? inverse(ga) : Identity<G>();
+
   std::vector<double> end_t(Nseg);
   std::vector<G> end_g(Nseg);
   std::vector<Eigen::Matrix<double, Dof<G>, K>> vs(Nseg);
   std::vector<double> seg_T0(Nseg), seg_Del(Nseg);
+  std::vector<G> seg_comp(Nseg);
 
   // copy over all relevant segments
   for (auto i = 0u; i < Nseg; ++i) {
     if (i == Nseg - 1) {
       end_t[i] = tb - ta;
-      end_g[i] = composition(inverse(ga), operator()(tb));
+      end_g[i] = composition(ga_inv, operator()(tb));
     } else {
       end_t[i] = m_end_t[i0 + i] - ta;
-      end_g[i] = composition(inverse(ga), m_end_g[i0 + i]);
+      end_g[i] = composition(ga_inv, m_end_g[i0 + i]);
     }
-    vs[i]      = m_Vs[i0 + i];
-    seg_T0[i]  = m_seg_T0[i0 + i];
-    seg_Del[i] = m_seg_Del[i0 + i];
+    vs[i]       = m_Vs[i0 + i];
+    seg_T0[i]   = m_seg_T0[i0 + i];
+    seg_Del[i]  = m_seg_Del[i0 + i];
+    seg_comp[i] = m_seg_comp[i0 + i];
   }
 
   // crop first segment
   {
-    const double tta = 0;
+    const double tta = i0 == 0 ? 0 : m_end_t[i0 - 1];
     const double ttb = m_end_t[i0];
     const double sa  = ta;
     const double sb  = ttb;
@@ -348,8 +496,8 @@ Spline<K, G> Spline<K, G>::crop(double ta, double tb, bool localize) const
 
   // crop last segment
   {
-    const double tta = Nseg == 1 ? ta : m_end_t[Nseg - 2];
-    const double ttb = m_end_t[Nseg - 1];
+    const double tta = Nseg == 1 ? ta : m_end_t[i0 + Nseg - 2];
+    const double ttb = m_end_t[i0 + Nseg - 1];
     const double sa  = tta;
     const double sb  = tb;
 
@@ -357,17 +505,80 @@ Spline<K, G> Spline<K, G>::crop(double ta, double tb, bool localize) const
     seg_Del[Nseg - 1] *= (sb - sa) / (ttb - tta);
   }
 
+  // first segment start changed, last segment start is unchanged
+  seg_comp[0] = crop_compensation(vs[0], seg_T0[0]);
+
   // create new Spline with appropriate body velocities
   Spline<K, G> ret;
-  ret.m_g0      = localize ? Identity<G>() : std::move(ga);
-  ret.m_end_t   = std::move(end_t);
-  ret.m_end_g   = std::move(end_g);
-  ret.m_Vs      = std::move(vs);
-  ret.m_seg_T0  = std::move(seg_T0);
-  ret.m_seg_Del = std::move(seg_Del);
+  ret.m_g0       = localize ? Identity<G>() : std::move(ga);
+  ret.m_end_t    = std::move(end_t);
+  ret.m_end_g    = std::move(end_g);
+  ret.m_Vs       = std::move(vs);
+  ret.m_seg_T0   = std::move(seg_T0);
+  ret.m_seg_Del  = std::move(seg_Del);
+  ret.m_seg_comp = std::move(seg_comp);
+  ret.update_arclength(0);
+  return ret;
+}
+
+template<int K, LieGroup G>
+SplineView<K, G> Spline<K, G>::view(double ta, double tb, bool localize) const
+{
+  return SplineView<K, G>(*this, ta, tb, localize);
+}
+
+template<int K, LieGroup G>
+G Spline<K, G>::segment_start(std::size_t i) const
+{
+  const G & g0 = i == 0 ? m_g0 : m_end_g[i - 1];
+
+  // compensate for cropped intervals
+  if (m_seg_T0[i] > 0) { return composition(g0, m_seg_comp[i]); }
+
+  return g0;
+}
+
+template<int K, LieGroup G>
+G Spline<K, G>::crop_compensation(const Eigen::Matrix<double, Dof<G>, K> & V, double T0)
+{
+  if constexpr (K > 0) {
+    if (T0 > 0) { return inverse(cspline_eval_vs<K, G>(V.colwise(), kMappedBasisFunction<K>, T0)); }
+  }
+  return Identity<G>();
+}
+
+template<int K, LieGroup G>
+Tangent<G> Spline<K, G>::segment_arclength(const Eigen::Matrix<double, Dof<G>, K> & V, double ua, double ub)
+  requires(K <= 3)
+{
+  Tangent<G> ret = Tangent<G>::Zero();
+
+  if constexpr (K > 0) {
+    // polynomial coefficients a0 + a1 x + a2 x2 + a3 x3
+    Eigen::Matrix<double, 4, Dof<G>> coefs = Eigen::Matrix<double, 4, Dof<G>>::Zero();
+    coefs.template topRows<K + 1>()        = kMappedBasisFunction<K>.rightCols(K) * V.transpose();
+
+    for (auto k = 0u; k < Dof<G>; ++k) {
+      // derivative b0 + b1 x + b2 x2 has coefficients [b0, b1, b2] = [a1, 2a2, 3a3]
+      ret(k) = integrate_absolute_polynomial(ua, ub, 3 * coefs(3, k), 2 * coefs(2, k), coefs(1, k));
+    }
+  }
+
   return ret;
 }
 
+template<int K, LieGroup G>
+void Spline<K, G>::update_arclength(std::size_t i0)
+{
+  if constexpr (K <= 3) {
+    m_seg_arclen.resize(size());
+    for (auto i = i0; i < size(); ++i) {
+      m_seg_arclen[i] = segment_arclength(m_Vs[i], m_seg_T0[i], m_seg_T0[i] + m_seg_Del[i]);
+      if (i > 0) { m_seg_arclen[i] += m_seg_arclen[i - 1]; }
+    }
+  }
+}
+
 template<int K, LieGroup G>
 std::size_t Spline<K, G>::find_idx(double t) const
 {
@@ -384,4 +595,89 @@ std::size_t Spline<K, G>::find_idx(double t) const
   return istar;
 }
 
+template<int K, LieGroup G>
+SplineView<K, G>::SplineView(const Spline<K, G> & spline, double ta, double tb, bool localize)
+    : m_spline(&spline), m_ta(std::max<double>(ta, 0)), m_tb(std::min<double>(tb, spline.t_max())),
+      m_localize(localize), m_ga_inv(inverse(spline(m_ta)))
+{
+  if (m_tb <= m_ta) {
+    m_tb = m_ta;
+    return;
+  }
+
+  m_i0 = spline.find_idx(m_ta);
+  m_i1 = spline.find_idx(m_tb);
+
+  // prevent last segment from being empty
+  if (m_i1 > m_i0 && spline.m_end_t[m_i1 - 1] == m_tb) { --m_i1; }
+}
+
+template<int K, LieGroup G>
+std::size_t SplineView<K, G>::size() const
+{
+  return empty() ? 0 : m_i1 + 1 - m_i0;
+}
+
+template<int K, LieGroup G>
+bool SplineView<K, G>::empty() const
+{
+  return m_tb <= m_ta;
+}
+
+template<int K, LieGroup G>
+double SplineView<K, G>::t_min() const
+{
+  return 0;
+}
+
+template<int K, LieGroup G>
+double SplineView<K, G>::t_max() const
+{
+  return m_tb - m_ta;
+}
+
+template<int K, LieGroup G>
+G SplineView<K, G>::start() const
+{
+  if (m_localize) { return Identity<G>(); }
+  return inverse(m_ga_inv);
+}
+
+template<int K, LieGroup G>
+G SplineView<K, G>::end() const
+{
+  return operator()(t_max());
+}
+
+template<int K, LieGroup G>
+template<typename S>
+CastT<S, G> SplineView<K, G>::operator()(const S & t, OptTangent<CastT<S, G>> vel, OptTangent<CastT<S, G>> acc) const
+{
+  if (empty() || t < S(0) || t > S(t_max())) {
+    if (vel.has_value()) { vel.value().setZero(); }
+    if (acc.has_value()) { acc.value().setZero(); }
+    if (empty() || t < S(0)) { return cast<S>(start()); }
+    return operator()(S(t_max()));
+  }
+
+  const S tp = t + S(m_ta);
+
+  // first segment in [m_i0, m_i1) that ends after tp, or m_i1
+  const auto & end_t = m_spline->m_end_t;
+  const auto it      = std::upper_bound(
+    end_t.begin() + static_cast<std::ptrdiff_t>(m_i0),
+    end_t.begin() + static_cast<std::ptrdiff_t>(m_i1),
+    static_cast<double>(tp));
+  const auto istar = static_cast<std::size_t>(std::distance(end_t.begin(), it));
+
+  const CastT<S, G> g = m_spline->eval_segment(istar, tp, vel, acc);
+  return m_localize ? composition(cast<S>(m_ga_inv), g) : g;
+}
+
+template<int K, LieGroup G>
+Spline<K, G> SplineView<K, G>::to_spline() const
+{
+  return m_spline->crop(m_ta, m_tb, m_localize);
+}
+
 SMOOTH_END_NAMESPACE
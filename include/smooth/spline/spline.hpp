@@ -8,12 +8,16 @@
  */
 
 #include <ranges>
+#include <span>
 
 #include "../lie_groups.hpp"
 #include "common.hpp"
 
 SMOOTH_BEGIN_NAMESPACE
 
+template<int K, LieGroup G>
+class SplineView;
+
 /**
  * @brief Single-parameter Lie group-valued function.
  *
@@ -65,6 +69,22 @@ public:
     requires(std::is_same_v<std::ranges::range_value_t<Rv>, Tangent<G>>)
   Spline(double T, const Rv & vs, const G & ga = Identity<G>());
 
+  /**
+   * @brief Create Spline from segment data in one pass.
+   *
+   * Segment i has duration dts[i] and velocities Vs[i], and starts at gs[i]. The last element of gs
+   * is the Spline end point. The result is equal to starting from an empty Spline and for each
+   * segment calling concat_global() with a one-segment Spline, followed by concat_global(gs.back()),
+   * but without creating any temporary Splines.
+   *
+   * @param dts segment durations (size N, strictly positive)
+   * @param gs segment start points followed by end point (size N + 1)
+   * @param Vs segment velocities (size N)
+   */
+  template<std::ranges::input_range Rt, std::ranges::input_range Rg>
+    requires(std::is_convertible_v<std::ranges::range_value_t<Rg>, G>)
+  Spline(const Rt & dts, const Rg & gs, std::vector<Eigen::Matrix<double, Dof<G>, K>> && Vs);
+
   /// @brief Copy constructor
   Spline(const Spline &) = default;
 
@@ -209,6 +229,28 @@ public:
   template<typename S = double>
   CastT<S, G> operator()(const S & t, OptTangent<CastT<S, G>> vel = {}, OptTangent<CastT<S, G>> acc = {}) const;
 
+  /**
+   * @brief Evaluate Spline at multiple times.
+   *
+   * Equivalent to calling operator() for each time, but segments are located by a forward cursor
+   * instead of a binary search per time. Queries are most efficient when ts is sorted in
+   * non-decreasing order; unsorted times fall back to a binary search.
+   *
+   * @param[in] ts times
+   * @param[out] gs output values (same size as ts)
+   * @param[out] vels output body velocities (empty or same size as ts)
+   * @param[out] accs output body accelerations (empty or same size as ts)
+   * @param[in] num_threads maximum number of threads (0 means std::thread::hardware_concurrency())
+   */
+  template<std::ranges::random_access_range Rt>
+    requires(std::ranges::sized_range<Rt>)
+  void eval(
+    const Rt & ts,
+    std::span<G> gs,
+    std::span<Tangent<G>> vels = {},
+    std::span<Tangent<G>> accs = {},
+    std::size_t num_threads    = 1) const;
+
   /**
    * @brief Get approximate arclength traversed at time T.
    *
@@ -218,10 +260,28 @@ public:
    * \f]
    * where the absolute value is component-wise.
    *
+   * Cumulative segment arclengths are stored in the Spline, so the complexity is O(log N) in the
+   * number of segments.
+   *
    * @note This function is approximate for Lie groups with curvature.
    */
   [[nodiscard]] Tangent<G> arclength(double t) const
-    requires(K == 3);
+    requires(K <= 3);
+
+  /**
+   * @brief Get time at which a weighted arclength is reached.
+   *
+   * Inverse of \f$ t \mapsto w^T A(t) \f$ where \f$ A(t) \f$ is the arclength defined in arclength().
+   * The complexity is O(log N) in the number of segments.
+   *
+   * @param s weighted arclength
+   * @param w non-negative component weights
+   * @return smallest t such that \f$ w^T A(t) \geq s \f$ (clamped to [t_min(), t_max()]), up to a
+   * tolerance of 1e-12 in arclength. If the Spline stands still when s is reached, the time at
+   * which it stops is returned.
+   */
+  [[nodiscard]] double time_at_arclength(double s, const Tangent<G> & w = Tangent<G>::Ones()) const
+    requires(K <= 3);
 
   /**
    * @brief Crop Spline
@@ -241,15 +301,47 @@ public:
    */
   [[nodiscard]] Spline crop(double ta, double tb = std::numeric_limits<double>::infinity(), bool localize = true) const;
 
+  /**
+   * @brief Non-owning cropped view of Spline.
+   *
+   * Same as crop() but does not copy any segment data. The Spline must outlive the view and not be
+   * modified while the view is in use.
+   *
+   * @see SplineView
+   */
+  [[nodiscard]] SplineView<K, G>
+  view(double ta, double tb = std::numeric_limits<double>::infinity(), bool localize = true) const;
+
 private:
+  friend class SplineView<K, G>;
+
   std::size_t find_idx(double t) const;
 
+  /// @brief Evaluate segment istar at time t (must be inside segment).
+  template<typename S>
+  CastT<S, G>
+  eval_segment(std::size_t istar, const S & t, OptTangent<CastT<S, G>> vel, OptTangent<CastT<S, G>> acc) const;
+
+  /// @brief Value at the start of segment i, compensated for cropping.
+  G segment_start(std::size_t i) const;
+
+  /// @brief Inverse of the segment function with velocities V at T0 (Identity if T0 = 0).
+  static G crop_compensation(const Eigen::Matrix<double, Dof<G>, K> & V, double T0);
+
+  /// @brief Arclength of the segment function with velocities V on [ua, ub].
+  static Tangent<G> segment_arclength(const Eigen::Matrix<double, Dof<G>, K> & V, double ua, double ub)
+    requires(K <= 3);
+
+  /// @brief Recompute cumulative arclengths of segments i0, i0 + 1, ...
+  void update_arclength(std::size_t i0);
+
   // segment i is defined by
   //
   //  - time interval:  m_end_t[i-1], m_end_t[i]
   //  - g interval:     m_end_g[i-1], m_end_g[i]
   //  - velocities:     m_Vs[i]
   //  - crop:           m_seg_T0[i], m_seg_Del[i]
+  //  - crop comp.:     m_seg_comp[i] = xu(T0[i])^{-1}
   //
   // s.t.
   //
@@ -271,6 +363,79 @@ private:
 
   // segment crop information
   std::vector<double> m_seg_T0, m_seg_Del;
+
+  // segment crop compensation (depends only on m_Vs and m_seg_T0)
+  std::vector<G> m_seg_comp;
+
+  // cumulative arclength at segment end times (empty if K > 3)
+  std::vector<Tangent<G>> m_seg_arclen;
+};
+
+/**
+ * @brief Non-owning view of a time window of a Spline.
+ *
+ * The view references the segment data of its parent Spline together with a time offset and the
+ * range of segments that cover the window, and evaluates to the same values as the corresponding
+ * Spline::crop(). Creating a view does not allocate.
+ *
+ * @note The parent Spline must outlive the view and must not be modified while the view is in use.
+ */
+template<int K, LieGroup G>
+class SplineView
+{
+public:
+  /**
+   * @brief Create view of spline on [ta, tb].
+   *
+   * @param spline parent Spline
+   * @param ta, tb interval in parent time (clamped to [spline.t_min(), spline.t_max()])
+   * @param localize view starts at identity
+   */
+  SplineView(
+    const Spline<K, G> & spline,
+    double ta     = 0,
+    double tb     = std::numeric_limits<double>::infinity(),
+    bool localize = true);
+
+  /// @brief Number of parent segments covered by the view.
+  [[nodiscard]] std::size_t size() const;
+
+  /// @brief True if the view has zero duration.
+  [[nodiscard]] bool empty() const;
+
+  /// @brief Start time of view (always equal to zero).
+  [[nodiscard]] double t_min() const;
+
+  /// @brief End time of view.
+  [[nodiscard]] double t_max() const;
+
+  /// @brief View start value.
+  [[nodiscard]] G start() const;
+
+  /// @brief View end value.
+  [[nodiscard]] G end() const;
+
+  /**
+   * @brief Evaluate view at given time.
+   *
+   * @see Spline::operator()
+   */
+  template<typename S = double>
+  CastT<S, G> operator()(const S & t, OptTangent<CastT<S, G>> vel = {}, OptTangent<CastT<S, G>> acc = {}) const;
+
+  /// @brief Create owning Spline equal to this view.
+  [[nodiscard]] Spline<K, G> to_spline() const;
+
+private:
+  const Spline<K, G> * m_spline;
+  double m_ta, m_tb;
+  bool m_localize;
+
+  // parent segments [m_i0, m_i1] cover [m_ta, m_tb]
+  std::size_t m_i0{0}, m_i1{0};
+
+  // inverse of parent value at m_ta
+  G m_ga_inv;
 };
 
 /**
@@ -1,5 +1,7 @@
 // Copyright (C) 2021-2022 Petter Nilsson. MIT License.
 
+#include <array>
+
 #include <gtest/gtest.h>
 
 #include "smooth/bundle.hpp"
@@ -73,3 +75,85 @@ TEST(Bundle, BundleOfBundle)
   ASSERT_TRUE(mb.part<1>().part<0>().isApprox(so3));
   ASSERT_TRUE(mb.part<1>().part<1>().isApprox(e3));
 }
+
+using RunBundle = Bundle<SO3d, Eigen::Vector3d, Eigen::Vector3d, SO2d, Eigen::Vector2d, Eigen::Vector3d, SE2d>;
+
+TEST(Bundle, EuclideanRuns)
+{
+  using Impl = liebase_info<RunBundle>::Impl;
+
+  static_assert(Impl::NumRuns == 5);
+  static_assert(Impl::RunParts == std::array<std::size_t, 6>{0, 1, 3, 4, 6, 7});
+
+  for (auto i = 0u; i < 5; ++i) {
+    const RunBundle g1 = RunBundle::Random();
+    const RunBundle g2 = RunBundle::Random();
+    const auto a       = RunBundle::Tangent::Random().eval();
+
+    const RunBundle g12  = g1 * g2;
+    const RunBundle ginv = g1.inverse();
+    const RunBundle gexp = RunBundle::exp(a);
+    const auto glog      = g1.log();
+
+    ASSERT_TRUE(g12.part<0>().isApprox(g1.part<0>() * g2.part<0>()));
+    ASSERT_TRUE(g12.part<2>().isApprox(g1.part<2>() + g2.part<2>()));
+    ASSERT_TRUE(g12.part<3>().isApprox(g1.part<3>() * g2.part<3>()));
+    ASSERT_TRUE(g12.part<5>().isApprox(g1.part<5>() + g2.part<5>()));
+    ASSERT_TRUE(ginv.part<1>().isApprox(-g1.part<1>()));
+    ASSERT_TRUE(ginv.part<6>().isApprox(g1.part<6>().inverse()));
+    ASSERT_TRUE(gexp.part<4>().isApprox(a.segment<2>(10)));
+    ASSERT_TRUE(gexp.part<6>().isApprox(SE2d::exp(a.segment<3>(15))));
+    ASSERT_TRUE(glog.segment<3>(12).isApprox(g1.part<5>()));
+    ASSERT_TRUE(glog.segment<3>(0).isApprox(g1.part<0>().log()));
+
+    ASSERT_TRUE(RunBundle::Identity().log().isZero());
+
+    Eigen::Matrix<double, 18, 18> Ad_expected = Eigen::Matrix<double, 18, 18>::Identity();
+    Ad_expected.block<3, 3>(0, 0)             = g1.part<0>().Ad();
+    Ad_expected.block<3, 3>(15, 15)           = g1.part<6>().Ad();
+    ASSERT_TRUE(g1.Ad().isApprox(Ad_expected));
+
+    Eigen::Matrix<double, 18, 18> dr_exp_expected = Eigen::Matrix<double, 18, 18>::Identity();
+    dr_exp_expected.block<3, 3>(0, 0)             = SO3d::dr_exp(a.segment<3>(0));
+    dr_exp_expected.block<3, 3>(15, 15)           = SE2d::dr_exp(a.segment<3>(15));
+    ASSERT_TRUE(RunBundle::dr_exp(a).isApprox(dr_exp_expected));
+    ASSERT_TRUE(RunBundle::dr_expinv(a).isApprox(dr_exp_expected.inverse()));
+
+    const auto tn_matrix = [](const auto & v) {
+      using V = std::decay_t<decltype(v)>;
+      Eigen::Matrix<double, V::SizeAtCompileTime + 1, V::SizeAtCompileTime + 1> ret;
+      ret.setIdentity();
+      ret.template topRightCorner<V::SizeAtCompileTime, 1>() = v;
+      return ret;
+    };
+
+    Eigen::Matrix<double, 23, 23> M_expected = Eigen::Matrix<double, 23, 23>::Zero();
+    M_expected.block<3, 3>(0, 0)             = g1.part<0>().matrix();
+    M_expected.block<4, 4>(3, 3)             = tn_matrix(g1.part<1>());
+    M_expected.block<4, 4>(7, 7)             = tn_matrix(g1.part<2>());
+    M_expected.block<2, 2>(11, 11)           = g1.part<3>().matrix();
+    M_expected.block<3, 3>(13, 13)           = tn_matrix(g1.part<4>());
+    M_expected.block<4, 4>(16, 16)           = tn_matrix(g1.part<5>());
+    M_expected.block<3, 3>(20, 20)           = g1.part<6>().matrix();
+    ASSERT_TRUE(g1.matrix().isApprox(M_expected));
+  }
+}
+
+TEST(Bundle, BlockDiagonal)
+{
+  for (auto i = 0u; i < 5; ++i) {
+    const RunBundle g = RunBundle::Random();
+    const auto a      = RunBundle::Tangent::Random().eval();
+    const auto x      = Eigen::Matrix<double, 18, 2>::Random().eval();
+
+    const auto Ad = g.Ad_blockdiag();
+    ASSERT_TRUE(Ad.toDense().isApprox(g.Ad()));
+    ASSERT_TRUE(Ad.template block<0>().isApprox(g.part<0>().Ad()));
+    ASSERT_TRUE((Ad * x).isApprox(g.Ad() * x));
+    ASSERT_TRUE(Ad.transpose().toDense().isApprox(g.Ad().transpose()));
+    ASSERT_TRUE(Ad.inverse().toDense().isApprox(g.inverse().Ad()));
+
+    ASSERT_TRUE(RunBundle::dr_exp_blockdiag(a).toDense().isApprox(RunBundle::dr_exp(a)));
+    ASSERT_TRUE(RunBundle::dr_expinv_blockdiag(a).toDense().isApprox(RunBundle::dr_expinv(a)));
+  }
+}
@@ -0,0 +1,98 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "smooth/covariance.hpp"
+#include "smooth/galilei.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/se3dq.hpp"
+#include "smooth/se_k_3.hpp"
+#include "smooth/so3.hpp"
+
+template<smooth::LieGroup G>
+class Covariance : public ::testing::Test
+{};
+
+using GroupsToTest =
+  ::testing::Types<smooth::SO3d, smooth::SE3d, smooth::SE3DQd, smooth::Galileid, smooth::SE_K_3<double, 2>>;
+
+TYPED_TEST_SUITE(Covariance, GroupsToTest, );
+
+template<typename M>
+M random_cov()
+{
+  const M L = M::Random();
+  return L * L.transpose();
+}
+
+TYPED_TEST(Covariance, Ad)
+{
+  using TangentMap = typename TypeParam::TangentMap;
+
+  for (auto i = 0u; i < 10; ++i) {
+    const auto g         = TypeParam::Random();
+    const TangentMap P   = random_cov<TangentMap>();
+    const TangentMap A   = g.Ad();
+    const TangentMap exp = A * P * A.transpose();
+
+    ASSERT_TRUE(g.Ad_cov(P).isApprox(exp, 1e-10));
+    ASSERT_TRUE(smooth::Ad_cov(g, P).isApprox(exp, 1e-10));
+  }
+}
+
+TYPED_TEST(Covariance, DrExp)
+{
+  using Tangent    = typename TypeParam::Tangent;
+  using TangentMap = typename TypeParam::TangentMap;
+
+  for (auto i = 0u; i < 10; ++i) {
+    const Tangent a      = Tangent::Random();
+    const TangentMap P   = random_cov<TangentMap>();
+    const TangentMap J   = TypeParam::dr_exp(a);
+    const TangentMap exp = J * P * J.transpose();
+
+    ASSERT_TRUE(TypeParam::dr_exp_cov(a, P).isApprox(exp, 1e-10));
+    ASSERT_TRUE(smooth::dr_exp_cov<TypeParam>(a, P).isApprox(exp, 1e-10));
+  }
+}
+
+TYPED_TEST(Covariance, Batch)
+{
+  using Tangent    = typename TypeParam::Tangent;
+  using TangentMap = typename TypeParam::TangentMap;
+
+  static constexpr std::size_t N = 1000;
+
+  std::vector<TypeParam> gs(N);
+  std::vector<Tangent> as(N);
+  std::vector<TangentMap> Ps(N), Ad_out(N), dr_out(N);
+  for (auto i = 0u; i < N; ++i) {
+    gs[i].setRandom();
+    as[i].setRandom();
+    Ps[i] = random_cov<TangentMap>();
+  }
+
+  smooth::Ad_cov_batch(gs, Ps, Ad_out, 4);
+  smooth::dr_exp_cov_batch<TypeParam>(as, Ps, dr_out, 4);
+
+  for (auto i = 0u; i < N; ++i) {
+    const TangentMap A = gs[i].Ad();
+    const TangentMap J = TypeParam::dr_exp(as[i]);
+    ASSERT_TRUE(Ad_out[i].isApprox(A * Ps[i] * A.transpose(), 1e-10));
+    ASSERT_TRUE(dr_out[i].isApprox(J * Ps[i] * J.transpose(), 1e-10));
+  }
+
+  // in-place
+  smooth::Ad_cov_batch(gs, Ps, Ps);
+  for (auto i = 0u; i < N; ++i) { ASSERT_TRUE(Ps[i].isApprox(Ad_out[i], 1e-10)); }
+}
+
+TEST(Covariance, Vector)
+{
+  const Eigen::Vector3d a = Eigen::Vector3d::Random();
+  const Eigen::Matrix3d P = random_cov<Eigen::Matrix3d>();
+
+  ASSERT_TRUE(smooth::dr_exp_cov<Eigen::Vector3d>(a, P).isApprox(P));
+}
@@ -6,8 +6,10 @@
 #include "smooth/c1.hpp"
 #include "smooth/compat/autodiff.hpp"
 #include "smooth/diff.hpp"
+#include "smooth/galilei.hpp"
 #include "smooth/se2.hpp"
 #include "smooth/se3.hpp"
+#include "smooth/se_k_3.hpp"
 #include "smooth/so2.hpp"
 #include "smooth/so3.hpp"
 
@@ -92,6 +94,8 @@ using TestGroups = ::testing::Types<
   smooth::SO3d,
   smooth::SE2d,
   smooth::SE3d,
+  smooth::Galileid,
+  smooth::SE_K_3<double, 2>,
   smooth::Bundle<Eigen::Vector2d, smooth::SE2d>>;
 
 TYPED_TEST_SUITE(SecondDerivatives, TestGroups, );
@@ -0,0 +1,237 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#define SMOOTH_FAST_MATH
+
+#include <algorithm>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "smooth/lie_array.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/so3.hpp"
+
+using ld = long double;
+
+namespace {
+
+/// @brief Sum of (-1)^k x2^k / (2k + o)! for k >= 0, scaled by s.
+ld alt_series(ld x2, int o, ld s = 1)
+{
+  ld term = 1, ret = 0;
+  for (int k = 1; k <= o; ++k) { term /= static_cast<ld>(k); }
+  for (int k = 0; k < 40; ++k) {
+    ret += term;
+    term *= -x2 / static_cast<ld>((2 * k + o + 1) * (2 * k + o + 2));
+  }
+  return s * ret;
+}
+
+/// @brief 1/x2 - (1 + cos x) / (2 x sin x) via Bernoulli series for small x2.
+ld dexpinv_ref(ld x2)
+{
+  if (x2 < 1) {
+    // sum_{n >= 1} |B_2n| x2^(n-1) / (2n)!
+    static constexpr std::array<ld, 10> B{
+      1.L / 6,
+      1.L / 30,
+      1.L / 42,
+      1.L / 30,
+      5.L / 66,
+      691.L / 2730,
+      7.L / 6,
+      3617.L / 510,
+      43867.L / 798,
+      174611.L / 330,
+    };
+    ld ret = 0, p = 1, fact = 1;
+    for (auto n = 1u; n <= B.size(); ++n) {
+      fact *= static_cast<ld>((2 * n - 1) * (2 * n));
+      ret += B[n - 1] * p / fact;
+      p *= x2;
+    }
+    return ret;
+  }
+  const ld x = std::sqrt(x2);
+  return 1 / x2 - (1 + std::cos(x)) / (2 * x * std::sin(x));
+}
+
+template<typename S>
+struct Bounds;
+
+template<>
+struct Bounds<float>
+{
+  static constexpr float rel = 2e-7f;
+  static constexpr float out = 1e-4f;
+};
+
+template<>
+struct Bounds<double>
+{
+  static constexpr double rel = 5e-16;
+  static constexpr double out = 1e-12;
+};
+
+}  // namespace
+
+template<typename S>
+class FastMath : public ::testing::Test
+{};
+
+using ScalarsToTest = ::testing::Types<float, double>;
+
+TYPED_TEST_SUITE(FastMath, ScalarsToTest, );
+
+TYPED_TEST(FastMath, PolynomialAccuracy)
+{
+  using S = TypeParam;
+  namespace fast = smooth::detail::fast;
+
+  static constexpr int N = 10000;
+
+  const auto rel_err = [](S val, ld ref) { return std::abs(static_cast<ld>(val) - ref) / std::abs(ref); };
+
+  for (int i = 0; i <= N; ++i) {
+    const S x2    = static_cast<S>(static_cast<ld>(M_PI * M_PI) * i / N);
+    const ld x2ld = static_cast<ld>(x2);
+
+    ASSERT_LE(std::abs(static_cast<ld>(fast::cos_half<S>(x2)) - alt_series(x2ld / 4, 0)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::sinc_half<S>(x2), alt_series(x2ld / 4, 1, 0.5L)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::cos_2<S>(x2), alt_series(x2ld, 2, -1)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::sin_3<S>(x2), alt_series(x2ld, 3, -1)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::cos_4<S>(x2), alt_series(x2ld, 4)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::sin_5<S>(x2), alt_series(x2ld, 5)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::cos_6<S>(x2), alt_series(x2ld, 6, -1)), Bounds<S>::rel);
+    ASSERT_LE(rel_err(fast::dexpinv<S>(x2), dexpinv_ref(x2ld)), Bounds<S>::rel);
+
+    const S t    = static_cast<S>(static_cast<ld>(i) / N);
+    const ld tld = static_cast<ld>(t);
+    ASSERT_LE(rel_err(fast::atan_sqrt<S>(t), i == 0 ? 1 : std::atan(std::sqrt(tld)) / std::sqrt(tld)), Bounds<S>::rel);
+  }
+}
+
+TYPED_TEST(FastMath, SO3)
+{
+  using S = TypeParam;
+
+  static_assert(smooth::detail::use_fast_math<S>);
+  static_assert(!smooth::detail::use_fast_math<ld>);
+
+  const S eps = S(20) * Eigen::NumTraits<S>::epsilon();
+
+  std::srand(5);
+
+  for (auto i = 0u; i < 100; ++i) {
+    // tangent with norm in [0, pi]
+    Eigen::Vector3<S> a = Eigen::Vector3<S>::Random().normalized() * static_cast<S>(M_PI) * static_cast<S>(i) / S(99);
+    if (i == 1) { a *= S(1e-6); }
+
+    const Eigen::Vector3<ld> ald = a.template cast<ld>();
+
+    // quaternion sign is ambiguous at angle pi
+    const smooth::SO3<S> g     = smooth::SO3<S>::exp(a);
+    const Eigen::Vector4<ld> q = smooth::SO3<ld>::exp(ald).coeffs();
+    ASSERT_LE(std::min((g.coeffs().template cast<ld>() - q).norm(), (g.coeffs().template cast<ld>() + q).norm()), eps);
+
+    const smooth::SO3<ld> gld = g.template cast<ld>();
+    ASSERT_LE((g.log().template cast<ld>() - gld.log()).norm(), eps * S(M_PI));
+
+    ASSERT_LE((smooth::SO3<S>::dr_exp(a).template cast<ld>() - smooth::SO3<ld>::dr_exp(ald)).norm(), eps);
+    ASSERT_LE((smooth::SO3<S>::dr_expinv(a).template cast<ld>() - smooth::SO3<ld>::dr_expinv(ald)).norm(), eps);
+
+    const auto [g_f, dr_f] = smooth::SO3<S>::exp_with_dr_exp(a);
+    ASSERT_TRUE(g_f.isApprox(g, eps));
+    ASSERT_TRUE(dr_f.isApprox(smooth::SO3<S>::dr_exp(a), eps));
+  }
+}
+
+TYPED_TEST(FastMath, OutOfRange)
+{
+  using S = TypeParam;
+
+  const auto rel_err = [](S val, ld ref) { return std::abs(static_cast<ld>(val) - ref) / std::abs(ref); };
+
+  // taylor tails fall back to the exact expressions for x2 > pi^2
+  for (int i = 1; i <= 100; ++i) {
+    const S x2    = static_cast<S>(static_cast<ld>(M_PI * M_PI) + static_cast<ld>(i));
+    const ld x2ld = static_cast<ld>(x2);
+
+    ASSERT_LE(rel_err(smooth::detail::cos_2<S>(x2), alt_series(x2ld, 2, -1)), Bounds<S>::out);
+    ASSERT_LE(rel_err(smooth::detail::sin_3<S>(x2), alt_series(x2ld, 3, -1)), Bounds<S>::out);
+    ASSERT_LE(rel_err(smooth::detail::cos_4<S>(x2), alt_series(x2ld, 4)), Bounds<S>::out);
+    ASSERT_LE(rel_err(smooth::detail::sin_5<S>(x2), alt_series(x2ld, 5)), Bounds<S>::out);
+    ASSERT_LE(rel_err(smooth::detail::cos_6<S>(x2), alt_series(x2ld, 6, -1)), Bounds<S>::out);
+  }
+
+  std::srand(5);
+
+  // SO3 with rotation angles above pi
+  for (const S th : {S(M_PI) + S(0.1), S(4), S(2 * M_PI) - S(0.01), S(8), S(12)}) {
+    for (auto i = 0u; i < 10; ++i) {
+      const Eigen::Vector3<S> a      = Eigen::Vector3<S>::Random().normalized() * th;
+      const Eigen::Vector3<ld> ald   = a.template cast<ld>();
+      const Eigen::Vector4<ld> q     = smooth::SO3<ld>::exp(ald).coeffs();
+      const Eigen::Matrix3<ld> dr    = smooth::SO3<ld>::dr_exp(ald);
+      const Eigen::Matrix3<ld> drinv = smooth::SO3<ld>::dr_expinv(ald);
+
+      const smooth::SO3<S> g = smooth::SO3<S>::exp(a);
+      ASSERT_LE((g.coeffs().template cast<ld>() - q).norm(), Bounds<S>::out);
+      ASSERT_LE((smooth::SO3<S>::dr_exp(a).template cast<ld>() - dr).norm(), Bounds<S>::out * dr.norm());
+      ASSERT_LE((smooth::SO3<S>::dr_expinv(a).template cast<ld>() - drinv).norm(), Bounds<S>::out * drinv.norm());
+
+      const auto [g_f, dr_f] = smooth::SO3<S>::exp_with_dr_exp(a);
+      ASSERT_LE((g_f.coeffs().template cast<ld>() - q).norm(), Bounds<S>::out);
+      ASSERT_LE((dr_f.template cast<ld>() - dr).norm(), Bounds<S>::out * dr.norm());
+
+      const smooth::SO3<ld> gld = g.template cast<ld>();
+      ASSERT_LE((g.log().template cast<ld>() - gld.log()).norm(), Bounds<S>::out);
+    }
+  }
+
+  // batched exp with some angles above pi
+  Eigen::Matrix<S, 3, -1> as = Eigen::Matrix<S, 3, -1>::Random(3, 10);
+  as.col(3) *= S(5);
+  const auto exps = smooth::LieArray<smooth::SO3<S>>::exp(as);
+  for (auto i = 0; i < as.cols(); ++i) {
+    const Eigen::Vector4<ld> q = smooth::SO3<ld>::exp(as.col(i).template cast<ld>().eval()).coeffs();
+    ASSERT_LE((exps[i].coeffs().template cast<ld>() - q).norm(), Bounds<S>::out);
+  }
+}
+
+TYPED_TEST(FastMath, SE3)
+{
+  using S = TypeParam;
+
+  const S eps = S(100) * Eigen::NumTraits<S>::epsilon();
+
+  std::srand(5);
+
+  for (auto i = 0u; i < 20; ++i) {
+    const Eigen::Vector<S, 6> a = Eigen::Vector<S, 6>::Random();
+    const Eigen::Vector<ld, 6> ald = a.template cast<ld>();
+
+    ASSERT_LE(
+      (smooth::SE3<S>::exp(a).coeffs().template cast<ld>() - smooth::SE3<ld>::exp(ald).coeffs()).norm(), eps);
+    ASSERT_LE((smooth::SE3<S>::dr_exp(a).template cast<ld>() - smooth::SE3<ld>::dr_exp(ald)).norm(), eps);
+    ASSERT_LE((smooth::SE3<S>::dr_expinv(a).template cast<ld>() - smooth::SE3<ld>::dr_expinv(ald)).norm(), eps);
+  }
+}
+
+TYPED_TEST(FastMath, LieArray)
+{
+  using S = TypeParam;
+
+  std::srand(5);
+
+  smooth::LieArray<smooth::SO3<S>> arr(50);
+  for (auto i = 0; i < arr.size(); ++i) { arr.set(i, smooth::SO3<S>::Random()); }
+
+  const auto logs = arr.log();
+  const auto exps = smooth::LieArray<smooth::SO3<S>>::exp(logs);
+  for (auto i = 0; i < arr.size(); ++i) {
+    ASSERT_TRUE(logs.col(i).isApprox(arr[i].log()));
+    ASSERT_TRUE(exps[i].isApprox(smooth::SO3<S>::exp(arr[i].log())));
+    ASSERT_TRUE(exps[i].isApprox(arr[i], S(10) * Eigen::NumTraits<S>::dummy_precision()));
+  }
+}
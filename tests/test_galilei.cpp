@@ -59,3 +59,20 @@ TEST(Galilei, dAction)
     ASSERT_TRUE(J_num.isApprox(J_ana, 1e-5));
   }
 }
+
+TEST(Galilei, BatchAction)
+{
+  const smooth::Galileid g             = smooth::Galileid::Random();
+  const Eigen::Matrix<double, 4, 10> V = Eigen::Matrix<double, 4, 10>::Random();
+
+  const auto GV  = g.action_batch(V);
+  const auto dGV = g.dr_action_batch(V);
+
+  static constexpr auto Dof = smooth::Galileid::Dof;
+
+  ASSERT_EQ(dGV.cols(), Dof * V.cols());
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE(GV.col(i).isApprox(g * V.col(i)));
+    ASSERT_TRUE(dGV.middleCols<Dof>(Dof * i).isApprox(g.dr_action(V.col(i))));
+  }
+}
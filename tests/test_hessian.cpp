@@ -185,3 +185,94 @@ TEST(Hessian, rminus)
     ASSERT_TRUE(H_num.isApprox(H_ana, 1e-4));
   }
 }
+
+TEST(Hessian, HessianVectorProduct)
+{
+  using G = smooth::SE3d;
+
+  for (auto i = 0u; i < 5; ++i) {
+    const auto f                     = Functor<G>{G::Random()};
+    const auto x                     = G::Random();
+    const Eigen::Vector<double, 6> v = Eigen::Vector<double, 6>::Random();
+
+    const auto [f_num, drf_num, d2f_num] = smooth::diff::dr<2, smooth::diff::Type::Numerical>(f, smooth::wrt(x));
+
+    const auto [f_hvp, drf_hvp, hv_num]    = smooth::diff::dr_hvp<smooth::diff::Type::Numerical>(f, smooth::wrt(x), v);
+    const auto [f_anal, drf_anal, hv_anal] = smooth::diff::dr_hvp<smooth::diff::Type::Analytic>(f, smooth::wrt(x), v);
+
+    ASSERT_EQ(hv_num.rows(), 6);
+    ASSERT_EQ(hv_num.cols(), 1);
+
+    ASSERT_DOUBLE_EQ(f_hvp, f_num);
+    ASSERT_TRUE(drf_hvp.isApprox(drf_num, 1e-3));
+    ASSERT_TRUE(hv_num.isApprox(d2f_num * v, 1e-3));
+    ASSERT_TRUE(hv_anal.isApprox(d2f_num * v, 1e-3));
+
+#ifdef ENABLE_AUTODIFF_TESTS
+    const auto [f_ad, drf_ad, hv_ad] = smooth::diff::dr_hvp<smooth::diff::Type::Autodiff>(f, smooth::wrt(x), v);
+    ASSERT_TRUE(drf_ad.isApprox(drf_num, 1e-3));
+    ASSERT_TRUE(hv_ad.isApprox(d2f_num * v, 1e-3));
+#endif
+  }
+}
+
+TEST(Hessian, HessianVectorProductMulti)
+{
+  const auto f = [](const auto & x1, const auto & x2) -> Eigen::Vector2d {
+    return Eigen::Vector2d(x1.log().squaredNorm() + x1.log().dot(x2), x2.squaredNorm() * x1.log().x());
+  };
+
+  const smooth::SO3d x1            = smooth::SO3d::Random();
+  const Eigen::Vector3d x2         = Eigen::Vector3d::Random();
+  const Eigen::Vector<double, 6> v = Eigen::Vector<double, 6>::Random();
+
+  const auto [fval, df, d2f]        = smooth::diff::dr<2, smooth::diff::Type::Numerical>(f, smooth::wrt(x1, x2));
+  const auto [fval_hvp, df_hvp, hv] = smooth::diff::dr_hvp(f, smooth::wrt(x1, x2), v);
+
+  ASSERT_EQ(hv.rows(), 6);
+  ASSERT_EQ(hv.cols(), 2);
+
+  ASSERT_TRUE(df_hvp.isApprox(df, 1e-3));
+  ASSERT_TRUE(hv.col(0).isApprox(d2f.middleCols(0, 6) * v, 1e-3));
+  ASSERT_TRUE(hv.col(1).isApprox(d2f.middleCols(6, 6) * v, 1e-3));
+}
+
+TEST(Hessian, BlockDiagonal)
+{
+  const auto f = [](const auto & x1, const auto & x2) -> Eigen::Vector2d {
+    return Eigen::Vector2d(x1.log().squaredNorm() + x1.log().dot(x2), x2.squaredNorm() * x1.log().x());
+  };
+
+  const smooth::SO3d x1    = smooth::SO3d::Random();
+  const Eigen::Vector3d x2 = Eigen::Vector3d::Random();
+
+  const auto [fval, df, d2f] = smooth::diff::dr<2, smooth::diff::Type::Numerical>(f, smooth::wrt(x1, x2));
+
+  // stacked diagonal blocks of the full Hessian
+  const auto blockdiag = [&d2f = d2f](int B) {
+    Eigen::MatrixXd ret = Eigen::MatrixXd::Zero(6, 2 * B);
+    for (auto i = 0; i < 2; ++i) {
+      for (auto j = 0; j < 6; ++j) {
+        for (auto k = 0; k < B && B * (j / B) + k < 6; ++k) { ret(j, i * B + k) = d2f(j, 6 * i + B * (j / B) + k); }
+      }
+    }
+    return ret;
+  };
+
+  const auto [fval_1, df_1, d2f_1] = smooth::diff::dr_hessian_blockdiag<1>(f, smooth::wrt(x1, x2));
+  ASSERT_EQ(d2f_1.rows(), 6);
+  ASSERT_EQ(d2f_1.cols(), 2);
+  ASSERT_TRUE(df_1.isApprox(df, 1e-3));
+  ASSERT_TRUE(d2f_1.isApprox(blockdiag(1), 1e-3));
+
+  const auto [fval_3, df_3, d2f_3] = smooth::diff::dr_hessian_blockdiag<3>(f, smooth::wrt(x1, x2));
+  ASSERT_EQ(d2f_3.rows(), 6);
+  ASSERT_EQ(d2f_3.cols(), 6);
+  ASSERT_TRUE(df_3.isApprox(df, 1e-3));
+  ASSERT_TRUE(d2f_3.isApprox(blockdiag(3), 1e-3));
+
+  // block size that does not divide the dimension
+  const auto [fval_4, df_4, d2f_4] = smooth::diff::dr_hessian_blockdiag<4>(f, smooth::wrt(x1, x2));
+  ASSERT_EQ(d2f_4.cols(), 8);
+  ASSERT_TRUE(d2f_4.isApprox(blockdiag(4), 1e-3));
+}
@@ -7,6 +7,7 @@
 #include "smooth/galilei.hpp"
 #include "smooth/se2.hpp"
 #include "smooth/se3.hpp"
+#include "smooth/se_k_3.hpp"
 #include "smooth/so2.hpp"
 #include "smooth/so3.hpp"
 
@@ -29,7 +30,23 @@ protected:
   }
 };
 
-using GroupsToTest = ::testing::Types<SO2d, SO3d, SE2d, SE3d, C1d, Galileid>;
+// numerical derivative of jacobian function J on horizontally stacked Hessian form
+template<LieGroup G>
+Hessian<G> d2_num(auto && J, const Tangent<G> & a)
+{
+  static constexpr auto N = Dof<G>;
+
+  const auto f_diff = [&J](const Tangent<G> & var) -> Eigen::Vector<Scalar<G>, N * N> {
+    return J(var).transpose().reshaped();
+  };
+  const auto [unused, D] = diff::dr<1, diff::Type::Numerical>(f_diff, wrt(a));
+
+  Hessian<G> ret;
+  for (auto i = 0; i < N; ++i) { ret.template middleCols<N>(N * i) = D.template middleRows<N>(N * i); }
+  return ret;
+}
+
+using GroupsToTest = ::testing::Types<SO2d, SO3d, SE2d, SE3d, C1d, Galileid, SE_K_3<double, 2>>;
 
 TYPED_TEST_SUITE(JacobianTest, GroupsToTest, );
 
@@ -58,3 +75,27 @@ TYPED_TEST(JacobianTest, drexpinv)
     ASSERT_TRUE(J_ana.isApprox(J_num, 1e-5));
   }
 }
+
+TYPED_TEST(JacobianTest, d2rexp)
+{
+  for (auto i = 0u; i < 5; ++i) {
+    this->a.setRandom();
+    if (i == 0) { this->a *= 1e-6; }
+
+    const auto H_num = d2_num<TypeParam>([](const auto & var) { return dr_exp<TypeParam>(var); }, this->a);
+
+    ASSERT_TRUE(d2r_exp<TypeParam>(this->a).isApprox(H_num, 1e-5));
+  }
+}
+
+TYPED_TEST(JacobianTest, d2rexpinv)
+{
+  for (auto i = 0u; i < 5; ++i) {
+    this->a.setRandom();
+    if (i == 0) { this->a *= 1e-6; }
+
+    const auto H_num = d2_num<TypeParam>([](const auto & var) { return dr_expinv<TypeParam>(var); }, this->a);
+
+    ASSERT_TRUE(d2r_expinv<TypeParam>(this->a).isApprox(H_num, 1e-5));
+  }
+}
@@ -11,6 +11,7 @@
 #include "smooth/lie_groups/native.hpp"
 #include "smooth/se2.hpp"
 #include "smooth/se3.hpp"
+#include "smooth/se3dq.hpp"
 #include "smooth/se_k_3.hpp"
 #include "smooth/so2.hpp"
 #include "smooth/so3.hpp"
@@ -21,10 +22,12 @@ class LieGroupInterface : public ::testing::Test
 
 using GroupsToTest = ::testing::Types<
   smooth::Bundle<smooth::SO2d, smooth::SO3d, smooth::SE2d, Eigen::Vector2d, smooth::SE3d>,
+  smooth::Bundle<smooth::SO3d, Eigen::Vector3d, Eigen::Vector3d, smooth::SO2d, Eigen::Vector2d, Eigen::Vector3d>,
   smooth::C1f,
   smooth::Galileid,
   smooth::SE2f,
   smooth::SE3f,
+  smooth::SE3DQd,
   smooth::SE_K_3<double, 2>,
   smooth::SO2f,
   smooth::SO3f>;
@@ -467,6 +470,70 @@ TYPED_TEST(LieGroupInterface, Jacobians)
   }
 }
 
+TYPED_TEST(LieGroupInterface, FusedJacobians)
+{
+  using Scalar = typename TypeParam::Scalar;
+
+  std::srand(5);
+
+  const Scalar eps = Scalar(1e2) * Eigen::NumTraits<Scalar>::dummy_precision();
+
+  for (auto i = 0u; i != 10; ++i) {
+    typename TypeParam::Tangent a = TypeParam::Tangent::Random();
+    if (i == 0) { a.setZero(); }
+    if (i == 1) { a *= Scalar(1e-5); }
+
+    const auto [g, dr_exp_a] = TypeParam::exp_with_dr_exp(a);
+    ASSERT_TRUE(g.isApprox(TypeParam::exp(a), eps));
+    ASSERT_TRUE(dr_exp_a.isApprox(TypeParam::dr_exp(a), eps));
+
+    const auto [log_g, dr_expinv_a] = g.log_with_dr_expinv();
+    ASSERT_TRUE(log_g.isApprox(g.log(), eps));
+    ASSERT_TRUE(dr_expinv_a.isApprox(TypeParam::dr_expinv(g.log()), eps));
+
+    // free function interface
+    const auto [g_free, dr_exp_free] = smooth::exp_with_dr_exp<TypeParam>(a);
+    ASSERT_TRUE(g_free.isApprox(g, eps));
+    ASSERT_TRUE(dr_exp_free.isApprox(dr_exp_a, eps));
+
+    const auto [log_free, dr_expinv_free] = smooth::log_with_dr_expinv(g);
+    ASSERT_TRUE(log_free.isApprox(log_g, eps));
+    ASSERT_TRUE(dr_expinv_free.isApprox(dr_expinv_a, eps));
+  }
+}
+
+TYPED_TEST(LieGroupInterface, BetweenRminus)
+{
+  using Scalar = typename TypeParam::Scalar;
+
+  std::srand(5);
+
+  const Scalar eps = Scalar(1e2) * Eigen::NumTraits<Scalar>::dummy_precision();
+
+  for (auto i = 0u; i != 10; ++i) {
+    const TypeParam g1 = TypeParam::Random();
+    const TypeParam g2 = TypeParam::Random();
+    const TypeParam z  = i == 0 ? TypeParam(g1.inverse() * g2) : TypeParam::Random();
+
+    // composed path
+    const TypeParam d                       = g1.inverse() * g2;
+    const typename TypeParam::Tangent r     = (z.inverse() * d).log();
+    const typename TypeParam::TangentMap J2 = TypeParam::dr_expinv(r);
+    const typename TypeParam::TangentMap J1 = -J2 * d.inverse().Ad();
+
+    const auto [r_f, J1_f, J2_f] = TypeParam::between_rminus(g1, g2, z);
+    ASSERT_TRUE(r_f.isApprox(r, eps) || (r_f - r).norm() < eps);
+    ASSERT_TRUE(J1_f.isApprox(J1, eps));
+    ASSERT_TRUE(J2_f.isApprox(J2, eps));
+
+    // free function interface
+    const auto [r_free, J1_free, J2_free] = smooth::between_rminus(g1, g2, z);
+    ASSERT_TRUE(r_free.isApprox(r_f, eps) || (r_free - r_f).norm() < eps);
+    ASSERT_TRUE(J1_free.isApprox(J1_f, eps));
+    ASSERT_TRUE(J2_free.isApprox(J2_f, eps));
+  }
+}
+
 TYPED_TEST(LieGroupInterface, Stream)
 {
   std::stringstream ss;
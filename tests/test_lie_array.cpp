@@ -0,0 +1,97 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#include <gtest/gtest.h>
+
+#include "smooth/lie_array.hpp"
+#include "smooth/se2.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/so3.hpp"
+
+template<typename G>
+class LieArrayTest : public ::testing::Test
+{};
+
+using GroupsToTest = ::testing::Types<smooth::SO3d, smooth::SE3d, smooth::SE2d>;
+
+TYPED_TEST_SUITE(LieArrayTest, GroupsToTest, );
+
+TYPED_TEST(LieArrayTest, Conversion)
+{
+  using G = TypeParam;
+
+  std::vector<G> gs(10);
+  for (auto & g : gs) { g = G::Random(); }
+
+  const smooth::LieArray<G> arr(gs);
+  ASSERT_EQ(arr.size(), 10);
+  for (auto i = 0u; i < gs.size(); ++i) { ASSERT_TRUE(arr[static_cast<Eigen::Index>(i)].isApprox(gs[i])); }
+
+  // to and from contiguous buffers of Map<G>
+  std::vector<double> buf(static_cast<std::size_t>(G::RepSize * arr.size()));
+  arr.copy_to(buf.data());
+  for (auto i = 0u; i < gs.size(); ++i) {
+    ASSERT_TRUE(smooth::Map<const G>(buf.data() + i * G::RepSize).isApprox(gs[i]));
+  }
+
+  const smooth::LieArray<G> arr2(
+    Eigen::Map<const Eigen::Matrix<double, G::RepSize, -1>>(buf.data(), G::RepSize, arr.size()));
+  ASSERT_TRUE(arr2.coeffs().isApprox(arr.coeffs()));
+
+  std::vector<smooth::Map<const G>> maps;
+  for (auto i = 0u; i < gs.size(); ++i) { maps.emplace_back(buf.data() + i * G::RepSize); }
+  const smooth::LieArray<G> arr3(maps);
+  ASSERT_TRUE(arr3.coeffs().isApprox(arr.coeffs()));
+
+  smooth::LieArray<G> arr4 = smooth::LieArray<G>::Identity(3);
+  arr4.set(1, gs[0]);
+  ASSERT_TRUE(arr4[0].isApprox(G::Identity()));
+  ASSERT_TRUE(arr4[1].isApprox(gs[0]));
+}
+
+TYPED_TEST(LieArrayTest, Operations)
+{
+  using G = TypeParam;
+
+  static constexpr Eigen::Index N = 25;
+
+  const auto arr1 = smooth::LieArray<G>::Random(N);
+  const auto arr2 = smooth::LieArray<G>::Random(N);
+
+  typename smooth::LieArray<G>::TangentArray a(G::Dof, N);
+  a.setRandom();
+  a.col(0).setZero();
+  a.col(1).setConstant(1e-6);
+
+  const auto comp = arr1 * arr2;
+  const auto inv  = arr1.inverse();
+  const auto log  = arr1.log();
+  const auto exp  = smooth::LieArray<G>::exp(a);
+  const auto plus = arr1 + a;
+  const auto diff = arr1 - arr2;
+
+  for (auto i = 0; i < N; ++i) {
+    ASSERT_TRUE(comp[i].isApprox(arr1[i] * arr2[i]));
+    ASSERT_TRUE(inv[i].isApprox(arr1[i].inverse()));
+    ASSERT_TRUE(log.col(i).isApprox(arr1[i].log()));
+    ASSERT_TRUE(exp[i].isApprox(G::exp(a.col(i))));
+    ASSERT_TRUE(plus[i].isApprox(arr1[i] + a.col(i)));
+    ASSERT_TRUE(diff.col(i).isApprox(arr1[i] - arr2[i]));
+  }
+}
+
+TYPED_TEST(LieArrayTest, Action)
+{
+  using G = TypeParam;
+
+  static constexpr Eigen::Index N = 25;
+  static constexpr int Dim        = std::is_same_v<G, smooth::SE2d> ? 2 : 3;
+
+  const auto arr = smooth::LieArray<G>::Random(N);
+
+  const Eigen::Matrix<double, Dim, -1> v = Eigen::Matrix<double, Dim, -1>::Random(Dim, N);
+  const auto res                         = arr.act(v);
+
+  ASSERT_EQ(res.rows(), Dim);
+  ASSERT_EQ(res.cols(), N);
+  for (auto i = 0; i < N; ++i) { ASSERT_TRUE(res.col(i).isApprox(arr[i] * v.col(i))); }
+}
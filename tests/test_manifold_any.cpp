@@ -1,13 +1,20 @@
 // Copyright (C) 2023 Petter Nilsson. MIT License.
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "smooth/galilei.hpp"
 #include "smooth/manifolds.hpp"
 #include "smooth/manifolds/any.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/se_k_3.hpp"
 #include "smooth/so3.hpp"
 
 using namespace smooth;
 
+using Vector20d = Eigen::Matrix<double, 20, 1>;
+
 TEST(AnyManifold, SO3)
 {
   std::srand(42);
@@ -54,3 +61,63 @@ TEST(AnyManifold, rminus)
 
   ASSERT_TRUE(d.isApprox(x1 - x2));
 }
+
+TEST(AnyManifold, Inline)
+{
+  ASSERT_TRUE(AnyManifold(smooth::SO3d::Random()).is_inline());
+  ASSERT_TRUE(AnyManifold(smooth::SE3d::Random()).is_inline());
+  ASSERT_TRUE(AnyManifold(smooth::Galileid::Random()).is_inline());
+  ASSERT_TRUE(AnyManifold(smooth::SE_K_3<double, 3>::Random()).is_inline());
+  ASSERT_TRUE(AnyManifold(Eigen::Vector3d::Random().eval()).is_inline());
+  ASSERT_TRUE(AnyManifold(Eigen::VectorXd::Random(40).eval()).is_inline());
+  ASSERT_FALSE(AnyManifold(Vector20d::Random().eval()).is_inline());
+}
+
+TEST(AnyManifold, rplus_inplace)
+{
+  std::srand(42);
+  const smooth::Galileid x = smooth::Galileid::Random();
+  const auto a             = smooth::Galileid::Tangent::Random().eval();
+
+  AnyManifold xa(x);
+  xa.rplus_inplace(a);
+
+  ASSERT_TRUE(xa.get<smooth::Galileid>().isApprox(x + a));
+}
+
+TEST(AnyManifold, CopyMove)
+{
+  std::srand(42);
+
+  const smooth::SE3d x = smooth::SE3d::Random();
+  const Vector20d v    = Vector20d::Random();
+
+  std::vector<AnyManifold> ms{AnyManifold(x), AnyManifold(v)};
+
+  // copy
+  std::vector<AnyManifold> ms_copy = ms;
+  ASSERT_TRUE(ms_copy[0].get<smooth::SE3d>().isApprox(x));
+  ASSERT_TRUE(ms_copy[1].get<Vector20d>().isApprox(v));
+
+  // copy assignment between heap and inline storage
+  ms_copy[0] = ms[1];
+  ms_copy[1] = ms[0];
+  ASSERT_TRUE(ms_copy[0].get<Vector20d>().isApprox(v));
+  ASSERT_TRUE(ms_copy[1].get<smooth::SE3d>().isApprox(x));
+
+  // move
+  AnyManifold m0(std::move(ms_copy[1]));
+  AnyManifold m1(std::move(ms_copy[0]));
+  ASSERT_TRUE(m0.get<smooth::SE3d>().isApprox(x));
+  ASSERT_TRUE(m1.get<Vector20d>().isApprox(v));
+
+  // move assignment
+  m0 = std::move(m1);
+  ASSERT_TRUE(m0.get<Vector20d>().isApprox(v));
+  ASSERT_FALSE(m0.is_inline());
+
+  // growing the vector moves elements
+  for (auto i = 0u; i < 50; ++i) { ms.emplace_back(smooth::SE3d::Random()); }
+  ASSERT_TRUE(ms[0].get<smooth::SE3d>().isApprox(x));
+  ASSERT_TRUE(ms[1].get<Vector20d>().isApprox(v));
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#include <gtest/gtest.h>
+
+#include "smooth/diff.hpp"
+#include "smooth/manifolds.hpp"
+#include "smooth/optim.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/so3.hpp"
+
+using Pool = smooth::ManifoldPool<smooth::SO3d, smooth::SE3d, Eigen::VectorXd>;
+
+static_assert(smooth::Manifold<Pool>);
+static_assert(smooth::Manifold<smooth::CastT<float, Pool>>);
+
+namespace {
+
+Pool make_pool()
+{
+  Pool pool;
+  pool.push_back(smooth::SO3d::Random());
+  pool.push_back(Eigen::VectorXd::Random(2).eval());
+  pool.push_back(smooth::SE3d::Random());
+  pool.push_back(smooth::SO3d::Random());
+  pool.push_back(Eigen::VectorXd::Random(4).eval());
+  return pool;
+}
+
+}  // namespace
+
+TEST(ManifoldPool, Api)
+{
+  std::srand(5);
+
+  const Pool pool = make_pool();
+
+  ASSERT_EQ(pool.size(), 5);
+  ASSERT_EQ(pool.array<0>().size(), 2);
+  ASSERT_EQ(pool.array<1>().size(), 1);
+  ASSERT_EQ(pool.array<2>().size(), 2);
+
+  ASSERT_EQ(pool.slot(3).type, 0);
+  ASSERT_EQ(pool.slot(3).index, 1);
+  ASSERT_EQ(pool.slot(4).type, 2);
+  ASSERT_EQ(pool.slot(4).index, 1);
+
+  ASSERT_EQ(smooth::dof(pool), 3 + 2 + 6 + 3 + 4);
+
+  // tangent is partitioned by type
+  ASSERT_EQ(pool.tangent_offset(0), 0);
+  ASSERT_EQ(pool.tangent_offset(3), 3);
+  ASSERT_EQ(pool.tangent_offset(2), 6);
+  ASSERT_EQ(pool.tangent_offset(1), 12);
+  ASSERT_EQ(pool.tangent_offset(4), 14);
+
+  Eigen::Index dof_sum = 0;
+  for (auto i = 0u; i < pool.size(); ++i) {
+    pool.visit(i, [&]<typename M>(const M & m) { dof_sum += smooth::dof(m); });
+  }
+  ASSERT_EQ(dof_sum, smooth::dof(pool));
+
+  ASSERT_TRUE(pool.get<smooth::SE3d>(2).isApprox(pool.array<1>()[0]));
+
+  const auto pool_f = smooth::cast<float>(pool);
+  ASSERT_EQ(pool_f.size(), 5);
+  ASSERT_EQ(pool_f.slot(4).type, 2);
+  ASSERT_TRUE(pool_f.get<smooth::SE3f>(2).isApprox(pool.get<smooth::SE3d>(2).cast<float>()));
+}
+
+TEST(ManifoldPool, RplusRminus)
+{
+  std::srand(5);
+
+  Pool pool = make_pool();
+
+  const Eigen::VectorXd a = Eigen::VectorXd::Random(smooth::dof(pool));
+
+  const Pool pool_plus_a = smooth::rplus(pool, a);
+  ASSERT_TRUE(smooth::rminus(pool_plus_a, pool).isApprox(a));
+
+  for (auto i = 0u; i < pool.size(); ++i) {
+    pool.visit(i, [&]<typename M>(const M & m) {
+      const auto off = pool.tangent_offset(i);
+      const auto n   = smooth::dof(m);
+      const M m_exp  = smooth::rplus(m, a.segment(off, n));
+      ASSERT_TRUE(smooth::rminus(pool_plus_a.get<M>(i), m_exp).isZero(1e-12));
+    });
+  }
+
+  // parallel execution gives the same result
+  const smooth::ManifoldVectorOptions opts{.num_threads = 3, .min_chunk = 1};
+  ASSERT_TRUE(pool.rplus(a, opts).rminus(pool, opts).isApprox(a));
+
+  smooth::rplus_assign(pool, a);
+  ASSERT_TRUE(smooth::rminus(pool, pool_plus_a).isZero(1e-12));
+}
+
+TEST(ManifoldPool, Optimize)
+{
+  std::srand(42);
+
+  auto f = []<typename T>(const smooth::ManifoldPool<smooth::SO3<T>, smooth::SE3<T>, Eigen::VectorX<T>> & var) {
+    Eigen::VectorX<T> ret(var.dof());
+    for (auto i = 0u; i < var.size(); ++i) {
+      var.visit(i, [&]<typename M>(const M & m) {
+        ret.segment(var.tangent_offset(i), smooth::dof(m)) = smooth::rminus(m, smooth::Default<M>(smooth::dof(m)));
+      });
+    }
+    return ret;
+  };
+
+  Pool pool = make_pool();
+
+  const auto [fval, df] = smooth::diff::dr<1>(f, smooth::wrt(pool));
+  ASSERT_EQ(df.rows(), smooth::dof(pool));
+  ASSERT_EQ(df.cols(), smooth::dof(pool));
+
+  smooth::MinimizeOptions opts{.ptol = 1e-9};
+  smooth::minimize(f, smooth::wrt(pool), opts);
+
+  for (const auto & x : pool.array<0>()) { ASSERT_LE(x.log().norm(), 1e-5); }
+  for (const auto & x : pool.array<1>()) { ASSERT_LE(x.log().norm(), 1e-5); }
+  for (const auto & x : pool.array<2>()) { ASSERT_LE(x.norm(), 1e-5); }
+}
@@ -4,6 +4,8 @@
 
 #include "smooth/manifolds.hpp"
 #include "smooth/manifolds/submanifold.hpp"
+#include "smooth/optim.hpp"
+#include "smooth/se3.hpp"
 #include "smooth/so3.hpp"
 
 using namespace smooth;
@@ -35,3 +37,74 @@ TEST(SubManifold, SO3plus)
   const auto diff = smooth::rminus(sm_p, sm);
   ASSERT_TRUE(diff.isApprox(a));
 }
+
+TEST(SubManifold, RplusAssign)
+{
+  std::srand(42);
+  const smooth::SO3d x = smooth::SO3d::Random();
+
+  smooth::SubManifold<smooth::SO3d> sm(x, Eigen::VectorXi{{0}});
+
+  const Eigen::Vector2d a = Eigen::Vector2d::Random();
+
+  const auto sm_p = smooth::rplus(sm, a);
+  smooth::rplus_assign(sm, a);
+
+  ASSERT_TRUE(sm.m().isApprox(sm_p.m()));
+  ASSERT_TRUE(sm.m0().isApprox(x));
+}
+
+TEST(StaticSubManifold, SE3)
+{
+  std::srand(42);
+  const smooth::SE3d x = smooth::SE3d::Random();
+
+  using SM = smooth::StaticSubManifold<smooth::SE3d, 2, 3, 4>;
+
+  static_assert(smooth::Manifold<SM>);
+  static_assert(smooth::Dof<SM> == 3);
+  static_assert(SM::ActiveDims == std::array<int, 3>{0, 1, 5});
+
+  const SM sm(x);
+  const SubManifold<SE3d> sm_dyn(x, Eigen::VectorXi{{2, 3, 4}});
+
+  const Eigen::Vector3d a = Eigen::Vector3d::Random();
+
+  const SM sm_p       = smooth::rplus(sm, a);
+  const auto sm_dyn_p = smooth::rplus(sm_dyn, a);
+
+  ASSERT_TRUE(sm_p.m().isApprox(sm_dyn_p.m()));
+  ASSERT_EQ(sm_p.m0_ptr(), sm.m0_ptr());
+
+  const Eigen::Vector3d diff = smooth::rminus(sm_p, sm);
+  ASSERT_TRUE(diff.isApprox(smooth::rminus(sm_dyn_p, sm_dyn)));
+  ASSERT_TRUE(diff.isApprox(a));
+
+  SM sm_a = sm;
+  smooth::rplus_assign(sm_a, a);
+  ASSERT_TRUE(sm_a.m().isApprox(sm_p.m()));
+  ASSERT_TRUE(sm_a.m0().isApprox(x));
+
+  const auto sm_f = smooth::cast<float>(sm_p);
+  ASSERT_TRUE(sm_f.m().isApprox(sm_p.m().cast<float>()));
+}
+
+TEST(StaticSubManifold, Optimize)
+{
+  std::srand(42);
+
+  // translation is fixed, only rotation is optimized
+  using SM = smooth::StaticSubManifold<smooth::SE3d, 0, 1, 2>;
+
+  auto f = []<typename T>(const smooth::StaticSubManifold<smooth::SE3<T>, 0, 1, 2> & x) -> Eigen::Vector<T, 3> {
+    return x.m().so3().log();
+  };
+
+  SM sm(smooth::SE3d::Random());
+  const Eigen::Vector3d p0 = sm.m().r3();
+
+  smooth::minimize(f, smooth::wrt(sm), smooth::MinimizeOptions{.ptol = 1e-9});
+
+  ASSERT_TRUE(sm.m().r3().isApprox(p0));
+  ASSERT_LE(sm.m().so3().log().norm(), 1e-5);
+}
@@ -35,3 +35,19 @@ TEST(ManifoldVariant, Api)
   const auto m2 = smooth::rplus(m, t);
   ASSERT_EQ(smooth::dof(m2), 3);
 }
+
+TEST(ManifoldVariant, RplusAssign)
+{
+  using M = std::variant<smooth::SO3d, double, Eigen::Vector2d>;
+
+  M m1                    = smooth::SO3d::Random();
+  const Eigen::VectorXd a = Eigen::VectorXd::Random(3);
+
+  const M m1_plus_a = smooth::rplus(m1, a);
+  smooth::rplus_assign(m1, a);
+  ASSERT_TRUE(std::get<smooth::SO3d>(m1).isApprox(std::get<smooth::SO3d>(m1_plus_a)));
+
+  M m2 = 1.5;
+  smooth::rplus_assign(m2, Eigen::VectorXd::Constant(1, 0.5));
+  ASSERT_DOUBLE_EQ(std::get<double>(m2), 2.);
+}
@@ -103,3 +103,91 @@ TEST(ManifoldVector, Optimize)
 
   for (const auto & x : m) { ASSERT_LE(x.log().norm(), 1e-5); }
 }
+
+TEST(ManifoldVector, OptimizeParallel)
+{
+  std::srand(42);
+
+  auto f = []<typename T>(const std::vector<smooth::SO3<T>> & var) -> Eigen::VectorX<T> {
+    Eigen::VectorX<T> ret(3 * static_cast<Eigen::Index>(var.size()));
+    for (auto i = 0u; i < var.size(); ++i) { ret.segment(3 * i, 3) = var[i].log(); }
+    return ret;
+  };
+
+  std::vector<smooth::SO3d> m(50);
+  for (auto & x : m) { x.setRandom(); }
+  auto m_ser = m;
+
+  const smooth::MinimizeOptions opts_ser{.ptol = 1e-9};
+  const smooth::MinimizeOptions opts_par{.ptol = 1e-9, .vector_exec = {.num_threads = 4, .min_chunk = 10}};
+
+  const auto res_ser = smooth::minimize(f, smooth::wrt(m_ser), opts_ser);
+  const auto res_par = smooth::minimize(f, smooth::wrt(m), opts_par);
+
+  ASSERT_EQ(res_ser.iter, res_par.iter);
+  for (auto i = 0u; i < m.size(); ++i) {
+    ASSERT_LE(m[i].log().norm(), 1e-5);
+    ASSERT_TRUE(m[i].isApprox(m_ser[i]));
+  }
+}
+
+TEST(ManifoldVector, RplusAssign)
+{
+  std::srand(5);
+
+  std::vector<smooth::SO3d> m(3);
+  for (auto & x : m) { x.setRandom(); }
+  const Eigen::VectorXd a = Eigen::VectorXd::Random(9);
+
+  const auto m_plus_a = smooth::rplus(m, a);
+  const auto * data   = m.data();
+
+  smooth::rplus_assign(m, a);
+
+  ASSERT_EQ(m.data(), data);
+  for (auto i = 0u; i < 3; ++i) { ASSERT_TRUE(m[i].isApprox(m_plus_a[i])); }
+}
+
+TEST(ManifoldVector, Parallel)
+{
+  std::srand(5);
+
+  static constexpr std::size_t N = 1000;
+
+  std::vector<smooth::SO3d> m1(N), m2(N);
+  for (auto & x : m1) { x.setRandom(); }
+  for (auto & x : m2) { x.setRandom(); }
+
+  std::vector<Eigen::VectorXd> v1(N), v2(N);
+  for (auto i = 0u; i < N; ++i) {
+    v1[i] = Eigen::VectorXd::Random(1 + i % 4);
+    v2[i] = Eigen::VectorXd::Random(1 + i % 4);
+  }
+
+  const Eigen::VectorXd a = Eigen::VectorXd::Random(smooth::dof(m1));
+  const Eigen::VectorXd b = Eigen::VectorXd::Random(smooth::dof(v1));
+
+  const auto m_plus_a_ser = smooth::rplus(m1, a);
+  const auto v_plus_b_ser = smooth::rplus(v1, b);
+  const auto m_diff_ser   = smooth::rminus(m1, m2);
+  const auto v_diff_ser   = smooth::rminus(v1, v2);
+
+  const smooth::ManifoldVectorOptions opts{.num_threads = 4, .min_chunk = 100};
+
+  const auto m_plus_a_par = smooth::rplus(m1, a, opts);
+  const auto v_plus_b_par = smooth::rplus(v1, b, opts);
+  const auto m_diff_par   = smooth::rminus(m1, m2, opts);
+  const auto v_diff_par   = smooth::rminus(v1, v2, opts);
+
+  smooth::rplus_assign(m1, a, opts);
+  smooth::rplus_assign(v1, b, opts);
+
+  ASSERT_TRUE(m_diff_par.isApprox(m_diff_ser));
+  ASSERT_TRUE(v_diff_par.isApprox(v_diff_ser));
+  for (auto i = 0u; i < N; ++i) {
+    ASSERT_TRUE(m_plus_a_par[i].isApprox(m_plus_a_ser[i]));
+    ASSERT_TRUE(v_plus_b_par[i].isApprox(v_plus_b_ser[i]));
+    ASSERT_TRUE(m1[i].isApprox(m_plus_a_ser[i]));
+    ASSERT_TRUE(v1[i].isApprox(v_plus_b_ser[i]));
+  }
+}
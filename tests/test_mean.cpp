@@ -0,0 +1,112 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "smooth/mean.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/so3.hpp"
+
+TEST(Mean, Symmetric)
+{
+  std::srand(5);
+
+  // samples mu + a_i and mu - a_i have mean mu and covariance sum a_i a_i' / N
+  const smooth::SO3d mu = smooth::SO3d::Random();
+
+  std::vector<smooth::SO3d> gs;
+  Eigen::Matrix3d cov = Eigen::Matrix3d::Zero();
+  for (auto i = 0u; i < 100; ++i) {
+    const Eigen::Vector3d a = 0.3 * Eigen::Vector3d::Random();
+    gs.push_back(mu + a);
+    gs.push_back(mu + (-a));
+    cov += 2 * a * a.transpose();
+  }
+  cov /= 200;
+
+  const auto res = smooth::karcher_mean(gs);
+  ASSERT_TRUE(res.converged);
+  ASSERT_TRUE(res.mean.isApprox(mu, 1e-10));
+  ASSERT_TRUE(res.cov.isApprox(cov, 1e-10));
+}
+
+TEST(Mean, Vector)
+{
+  std::srand(5);
+
+  std::vector<Eigen::Vector3d> xs(50);
+  for (auto & x : xs) { x.setRandom(); }
+
+  Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+  for (const auto & x : xs) { mean += x; }
+  mean /= 50;
+
+  const auto res = smooth::karcher_mean(xs);
+  ASSERT_TRUE(res.converged);
+  ASSERT_TRUE(res.mean.isApprox(mean));
+}
+
+TEST(Mean, Weighted)
+{
+  std::srand(5);
+
+  std::vector<smooth::SE3d> gs(20);
+  for (auto & g : gs) { g.setRandom(); }
+
+  // zero weights remove samples
+  std::vector<double> ws(40, 0.);
+  std::vector<smooth::SE3d> gs2 = gs;
+  for (auto i = 0u; i < 20; ++i) {
+    gs2.push_back(smooth::SE3d::Random());
+    ws[i] = 2.5;
+  }
+
+  const auto res  = smooth::karcher_mean(gs);
+  const auto resw = smooth::karcher_mean(gs2, ws);
+  ASSERT_TRUE(res.converged);
+  ASSERT_TRUE(resw.converged);
+  ASSERT_TRUE(resw.mean.isApprox(res.mean, 1e-10));
+  ASSERT_TRUE(resw.cov.isApprox(res.cov, 1e-10));
+
+  // first-order optimality
+  Eigen::Vector<double, 6> grad = Eigen::Vector<double, 6>::Zero();
+  for (const auto & g : gs) { grad += g - res.mean; }
+  ASSERT_LE(grad.norm(), 1e-10);
+}
+
+TEST(Mean, Parallel)
+{
+  std::srand(5);
+
+  std::vector<smooth::SO3d> gs(2000);
+  for (auto & g : gs) { g = smooth::SO3d::exp(0.5 * Eigen::Vector3d::Random()); }
+
+  const auto res1 = smooth::karcher_mean(gs, {.num_threads = 1});
+  const auto res4 = smooth::karcher_mean(gs, {.num_threads = 4, .min_chunk = 100});
+  ASSERT_TRUE(res1.converged);
+  ASSERT_TRUE(res4.converged);
+  ASSERT_TRUE(res4.mean.isApprox(res1.mean, 1e-10));
+  ASSERT_TRUE(res4.cov.isApprox(res1.cov, 1e-10));
+}
+
+TEST(Mean, NotConverged)
+{
+  std::srand(5);
+
+  std::vector<smooth::SE3d> gs(20);
+  for (auto & g : gs) { g.setRandom(); }
+
+  const auto res = smooth::karcher_mean(gs, {.max_iter = 1});
+  ASSERT_FALSE(res.converged);
+  ASSERT_EQ(res.iter, 1u);
+
+  // covariance is evaluated at the returned mean
+  Eigen::Matrix<double, 6, 6> cov = Eigen::Matrix<double, 6, 6>::Zero();
+  for (const auto & g : gs) {
+    const Eigen::Vector<double, 6> e = g - res.mean;
+    cov += e * e.transpose();
+  }
+  cov /= 20;
+  ASSERT_TRUE(res.cov.isApprox(cov, 1e-10));
+}
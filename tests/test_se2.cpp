@@ -122,3 +122,20 @@ TEST(SE2, ToFromEigen)
     }
   }
 }
+
+TEST(SE2, BatchAction)
+{
+  const smooth::SE2d g                 = smooth::SE2d::Random();
+  const Eigen::Matrix<double, 2, 10> V = Eigen::Matrix<double, 2, 10>::Random();
+
+  const auto GV  = g.action_batch(V);
+  const auto dGV = g.dr_action_batch(V);
+
+  static constexpr auto Dof = smooth::SE2d::Dof;
+
+  ASSERT_EQ(dGV.cols(), Dof * V.cols());
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE(GV.col(i).isApprox(g * V.col(i)));
+    ASSERT_TRUE(dGV.middleCols<Dof>(Dof * i).isApprox(g.dr_action(V.col(i))));
+  }
+}
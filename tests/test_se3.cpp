@@ -81,3 +81,47 @@ TEST(SE3, ToFromEigen)
     }
   }
 }
+
+TEST(SE3, BatchAction)
+{
+  const smooth::SE3d g                 = smooth::SE3d::Random();
+  const Eigen::Matrix<double, 3, 10> V = Eigen::Matrix<double, 3, 10>::Random();
+
+  const auto GV  = g.action_batch(V);
+  const auto dGV = g.dr_action_batch(V);
+
+  static constexpr auto Dof = smooth::SE3d::Dof;
+
+  ASSERT_EQ(dGV.cols(), Dof * V.cols());
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE(GV.col(i).isApprox(g * V.col(i)));
+    ASSERT_TRUE(dGV.middleCols<Dof>(Dof * i).isApprox(g.dr_action(V.col(i))));
+  }
+}
+
+TEST(SE3, Cached)
+{
+  static_assert(smooth::LieGroup<smooth::SE3Cachedd>);
+
+  const smooth::SE3d g = smooth::SE3d::Random();
+  const smooth::SE3Cachedd gc(g);
+
+  ASSERT_TRUE(smooth::SE3Cachedd().isApprox(smooth::SE3d::Identity()));
+  ASSERT_TRUE(smooth::SE3Cachedd(g.so3(), g.r3()).isApprox(g));
+
+  ASSERT_TRUE(gc.isApprox(g));
+  ASSERT_TRUE(gc.rotation_matrix().isApprox(g.so3().matrix()));
+  ASSERT_TRUE(gc.matrix().isApprox(g.matrix()));
+  ASSERT_TRUE(gc.Ad().isApprox(g.Ad()));
+  ASSERT_TRUE(gc.log().isApprox(g.log()));
+  ASSERT_TRUE((gc * g).isApprox(g * g));
+  ASSERT_TRUE(gc.inverse().isApprox(g.inverse()));
+
+  const Eigen::Matrix<double, 3, 10> V = Eigen::Matrix<double, 3, 10>::Random();
+  ASSERT_TRUE(gc.action_batch(V).isApprox(g.action_batch(V)));
+  ASSERT_TRUE(gc.dr_action_batch(V).isApprox(g.dr_action_batch(V)));
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE((gc * V.col(i)).isApprox(g * V.col(i)));
+    ASSERT_TRUE(gc.dr_action(V.col(i)).isApprox(g.dr_action(V.col(i))));
+  }
+}
@@ -0,0 +1,82 @@
+// Copyright (C) 2021-2022 Petter Nilsson. MIT License.
+
+#include <gtest/gtest.h>
+
+#include "smooth/se3dq.hpp"
+
+TEST(SE3DQ, Conversions)
+{
+  for (auto i = 0u; i < 10; ++i) {
+    const smooth::SE3d g = smooth::SE3d::Random();
+    const smooth::SE3DQd dq(g);
+
+    ASSERT_TRUE(dq.se3().isApprox(g));
+    ASSERT_TRUE(dq.so3().isApprox(g.so3()));
+    ASSERT_TRUE(dq.r3().isApprox(g.r3()));
+    ASSERT_TRUE(smooth::SE3DQd(g.so3(), g.r3()).isApprox(dq));
+    ASSERT_TRUE(dq.matrix().isApprox(g.matrix()));
+    ASSERT_TRUE(dq.Ad().isApprox(g.Ad()));
+
+    // unit dual quaternion constraints
+    ASSERT_NEAR(dq.real().norm(), 1., 1e-10);
+    ASSERT_NEAR(dq.real().coeffs().dot(dq.dual().coeffs()), 0., 1e-10);
+  }
+}
+
+TEST(SE3DQ, GroupOperations)
+{
+  for (auto i = 0u; i < 10; ++i) {
+    const smooth::SE3d g1 = smooth::SE3d::Random();
+    const smooth::SE3d g2 = smooth::SE3d::Random();
+    const smooth::SE3DQd dq1(g1), dq2(g2);
+
+    ASSERT_TRUE((dq1 * dq2).se3().isApprox(g1 * g2));
+    ASSERT_TRUE(dq1.inverse().se3().isApprox(g1.inverse()));
+    ASSERT_TRUE((dq1 * dq1.inverse()).isApprox(smooth::SE3DQd::Identity()));
+    ASSERT_GE((dq1 * dq2).real().w(), 0.);
+
+    const Eigen::Vector<double, 6> a = Eigen::Vector<double, 6>::Random();
+    ASSERT_TRUE(smooth::SE3DQd::exp(a).se3().isApprox(smooth::SE3d::exp(a)));
+    ASSERT_TRUE(dq1.log().isApprox(g1.log()));
+  }
+}
+
+TEST(SE3DQ, Interoperability)
+{
+  const smooth::SE3d g1 = smooth::SE3d::Random();
+  const smooth::SE3d g2 = smooth::SE3d::Random();
+  const smooth::SE3DQd dq1(g1), dq2(g2);
+
+  // tangent vectors are interchangeable
+  ASSERT_TRUE((dq2 - dq1).isApprox(g2 - g1));
+  ASSERT_TRUE((dq1 + (g2 - g1)).isApprox(dq2));
+
+  // screw interpolation
+  for (const double t : {0., 0.25, 0.5, 1.}) {
+    ASSERT_TRUE((dq1 + t * (dq2 - dq1)).se3().isApprox(g1 + t * (g2 - g1)));
+  }
+}
+
+TEST(SE3DQ, Action)
+{
+  const smooth::SE3d g = smooth::SE3d::Random();
+  const smooth::SE3DQd dq(g);
+
+  for (auto i = 0u; i < 10; ++i) {
+    const Eigen::Vector3d v = Eigen::Vector3d::Random();
+    ASSERT_TRUE((dq * v).isApprox(g * v));
+    ASSERT_TRUE(dq.dr_action(v).isApprox(g.dr_action(v)));
+  }
+}
+
+TEST(SE3DQ, Chain)
+{
+  smooth::SE3d g    = smooth::SE3d::Identity();
+  smooth::SE3DQd dq = smooth::SE3DQd::Identity();
+  for (auto i = 0u; i < 100; ++i) {
+    const smooth::SE3d gi = smooth::SE3d::Random();
+    g *= gi;
+    dq *= smooth::SE3DQd(gi);
+  }
+  ASSERT_TRUE(dq.se3().isApprox(g, 1e-10));
+}
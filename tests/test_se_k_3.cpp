@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "smooth/diff.hpp"
 #include "smooth/se_k_3.hpp"
 
 TEST(SE_K_3, Constructor)
@@ -33,3 +34,26 @@ TEST(SE_K_3, Parts)
   ASSERT_TRUE(Xmut.block(0, 4, 3, 1).isApprox(x.r3<1>()));
   ASSERT_TRUE(Xmut.block(0, 0, 3, 3).isApprox(x.so3().matrix()));
 }
+
+TEST(SE_K_3, BatchAction)
+{
+  using G = smooth::SE_K_3<double, 2>;
+
+  const G x                           = G::Random();
+  const Eigen::Matrix<double, 5, 8> V = Eigen::Matrix<double, 5, 8>::Random();
+
+  const auto XV  = x.action_batch(V);
+  const auto dXV = x.dr_action_batch(V);
+
+  ASSERT_TRUE(XV.isApprox(x.matrix() * V));
+  ASSERT_EQ(dXV.cols(), G::Dof * V.cols());
+
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    const Eigen::Vector<double, 5> v = V.col(i);
+
+    const auto f_diff          = [&v](const G & var) -> Eigen::Vector<double, 5> { return var.action_batch(v); };
+    const auto [unused, J_num] = smooth::diff::dr<1, smooth::diff::Type::Numerical>(f_diff, smooth::wrt(x));
+
+    ASSERT_TRUE(J_num.isApprox(dXV.middleCols<G::Dof>(G::Dof * i), 1e-5));
+  }
+}
@@ -68,3 +68,20 @@ TEST(SO2, LiftProject)
     ASSERT_TRUE(so2.isApprox(g, 1e-6));
   }
 }
+
+TEST(SO2, BatchAction)
+{
+  const smooth::SO2d g                 = smooth::SO2d::Random();
+  const Eigen::Matrix<double, 2, 10> V = Eigen::Matrix<double, 2, 10>::Random();
+
+  const auto GV  = g.action_batch(V);
+  const auto dGV = g.dr_action_batch(V);
+
+  static constexpr auto Dof = smooth::SO2d::Dof;
+
+  ASSERT_EQ(dGV.cols(), Dof * V.cols());
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE(GV.col(i).isApprox(g * V.col(i)));
+    ASSERT_TRUE(dGV.middleCols<Dof>(Dof * i).isApprox(g.dr_action(V.col(i))));
+  }
+}
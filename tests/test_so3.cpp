@@ -159,3 +159,88 @@ TEST(SE3, SignedInverse)
   ASSERT_TRUE(g1.isApprox(g2));
   ASSERT_LE((g1 - g2).cwiseAbs().maxCoeff(), 1e-10);
 }
+
+TEST(SO3, BatchAction)
+{
+  const smooth::SO3d g                 = smooth::SO3d::Random();
+  const Eigen::Matrix<double, 3, 10> V = Eigen::Matrix<double, 3, 10>::Random();
+
+  const auto GV  = g.action_batch(V);
+  const auto dGV = g.dr_action_batch(V);
+
+  static constexpr auto Dof = smooth::SO3d::Dof;
+
+  ASSERT_EQ(dGV.cols(), Dof * V.cols());
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE(GV.col(i).isApprox(g * V.col(i)));
+    ASSERT_TRUE(dGV.middleCols<Dof>(Dof * i).isApprox(g.dr_action(V.col(i))));
+  }
+}
+
+TEST(SO3, Cached)
+{
+  static_assert(smooth::LieGroup<smooth::SO3Cachedd>);
+
+  const smooth::SO3d g = smooth::SO3d::Random();
+  const smooth::SO3Cachedd gc(g);
+
+  ASSERT_TRUE(smooth::SO3Cachedd().isApprox(smooth::SO3d::Identity()));
+  ASSERT_TRUE(smooth::SO3Cachedd(g.quat()).isApprox(g));
+
+  ASSERT_TRUE(gc.isApprox(g));
+  ASSERT_TRUE(gc.matrix().isApprox(g.matrix()));
+  ASSERT_TRUE(gc.Ad().isApprox(g.Ad()));
+  ASSERT_TRUE(gc.log().isApprox(g.log()));
+  ASSERT_TRUE((gc * g).isApprox(g * g));
+  ASSERT_TRUE(gc.inverse().isApprox(g.inverse()));
+
+  const Eigen::Matrix<double, 3, 10> V = Eigen::Matrix<double, 3, 10>::Random();
+  ASSERT_TRUE(gc.action_batch(V).isApprox(g.action_batch(V)));
+  ASSERT_TRUE(gc.dr_action_batch(V).isApprox(g.dr_action_batch(V)));
+  for (Eigen::Index i = 0; i != V.cols(); ++i) {
+    ASSERT_TRUE((gc * V.col(i)).isApprox(g * V.col(i)));
+    ASSERT_TRUE(gc.dr_action(V.col(i)).isApprox(g.dr_action(V.col(i))));
+  }
+
+  const smooth::SO3d g2  = smooth::SO3d::Random();
+  smooth::SO3Cachedd gc2 = gc;
+
+  gc2 = g2;
+  ASSERT_TRUE(gc2.matrix().isApprox(g2.matrix()));
+}
+
+TEST(SO3, Accumulator)
+{
+  std::srand(5);
+
+  // float drifts quickly, exercise renormalization
+  {
+    smooth::SO3Accumulatorf acc;
+    smooth::SO3d ref = smooth::SO3d::Identity();
+    for (auto i = 0u; i < 100000; ++i) {
+      const Eigen::Vector3f a = 0.01f * Eigen::Vector3f::Random();
+      acc += a;
+      ref += a.cast<double>();
+
+      const smooth::SO3f g = acc.value();
+      ASSERT_LE(std::abs(g.coeffs().squaredNorm() - 1.f), smooth::SO3Accumulatorf::default_tol());
+      ASSERT_GE(g.coeffs()(3), 0.f);
+    }
+    ASSERT_GT(acc.renormalizations(), 0u);
+    ASSERT_LE((acc.value().cast<double>() - ref).norm(), 1e-3);
+  }
+
+  // double agrees with plain composition
+  {
+    const smooth::SO3d g0 = smooth::SO3d::Random();
+    smooth::SO3Accumulatord acc(g0);
+    smooth::SO3d ref = g0;
+    for (auto i = 0u; i < 10000; ++i) {
+      const smooth::SO3d gi = smooth::SO3d::Random();
+      acc *= gi;
+      ref *= gi;
+      ASSERT_LE(acc.drift_bound(), smooth::SO3Accumulatord::default_tol());
+    }
+    ASSERT_TRUE(acc.value().isApprox(ref, 1e-10));
+  }
+}
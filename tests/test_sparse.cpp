@@ -6,14 +6,17 @@
 
 #include "smooth/bundle.hpp"
 #include "smooth/c1.hpp"
+#include "smooth/galilei.hpp"
 #include "smooth/lie_sparse.hpp"
 #include "smooth/se2.hpp"
 #include "smooth/se3.hpp"
+#include "smooth/se_k_3.hpp"
 
 using BundleT1 = smooth::Bundle<Eigen::Vector3d, smooth::SO2d>;
 using BundleT2 = smooth::Bundle<Eigen::Vector3d, smooth::SO3d>;
 using BundleT3 =
   smooth::Bundle<smooth::SE2d, Eigen::Vector3d, smooth::SO3d, Eigen::Vector2d, smooth::C1d, BundleT2, smooth::SE3d>;
+using BundleT4 = smooth::Bundle<smooth::Galileid, smooth::C1d, smooth::SE_K_3<double, 2>>;
 
 TEST(Sparse, ad_nonzeros)
 {
@@ -39,6 +42,10 @@ TEST(Sparse, dexp_nonzeros)
   ASSERT_EQ(smooth::d_exp_sparse_pattern<BundleT1>.nonZeros(), 4);
   ASSERT_EQ(smooth::d_exp_sparse_pattern<BundleT2>.nonZeros(), 12);
   ASSERT_EQ(smooth::d_exp_sparse_pattern<BundleT3>.nonZeros(), 7 + 3 + 9 + 2 + 2 + 12 + 27);
+  ASSERT_EQ(smooth::d_exp_sparse_pattern<smooth::Galileid>.nonZeros(), 58);
+  ASSERT_EQ((smooth::d_exp_sparse_pattern<smooth::SE_K_3<double, 1>>.nonZeros()), 27);
+  ASSERT_EQ((smooth::d_exp_sparse_pattern<smooth::SE_K_3<double, 2>>.nonZeros()), 45);
+  ASSERT_EQ(smooth::d_exp_sparse_pattern<BundleT4>.nonZeros(), 58 + 2 + 45);
 }
 
 TEST(Sparse, d2exp_nonzeros)
@@ -52,6 +59,10 @@ TEST(Sparse, d2exp_nonzeros)
   ASSERT_EQ(smooth::d2_exp_sparse_pattern<BundleT1>.nonZeros(), 0);
   ASSERT_EQ(smooth::d2_exp_sparse_pattern<BundleT2>.nonZeros(), 27);
   ASSERT_EQ(smooth::d2_exp_sparse_pattern<BundleT3>.nonZeros(), 10 + 27 + 27 + 36 * 3);
+  ASSERT_EQ(smooth::d2_exp_sparse_pattern<smooth::Galileid>.nonZeros(), 279);
+  ASSERT_EQ((smooth::d2_exp_sparse_pattern<smooth::SE_K_3<double, 1>>.nonZeros()), 36 * 3);
+  ASSERT_EQ((smooth::d2_exp_sparse_pattern<smooth::SE_K_3<double, 2>>.nonZeros()), 3 * 27 + 2 * 54);
+  ASSERT_EQ(smooth::d2_exp_sparse_pattern<BundleT4>.nonZeros(), 279 + 3 * 27 + 2 * 54);
 }
 
 template<smooth::LieGroup G>
@@ -68,7 +79,10 @@ using TestGroups = ::testing::Types<
   smooth::SE3f,
   BundleT1,
   BundleT2,
-  BundleT3>;
+  BundleT3,
+  smooth::Galileid,
+  smooth::SE_K_3<double, 2>,
+  BundleT4>;
 
 TYPED_TEST_SUITE(Sparse, TestGroups, );
 
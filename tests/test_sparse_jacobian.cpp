@@ -0,0 +1,115 @@
+// Copyright (C) 2023 Petter Nilsson. MIT License.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "smooth/lie_sparse.hpp"
+#include "smooth/se3.hpp"
+#include "smooth/sparse_jacobian.hpp"
+
+template<typename B>
+class SparseJacobian : public ::testing::Test
+{};
+
+using BuildersToTest = ::testing::
+  Types<smooth::SparseJacobianBuilder<double, Eigen::ColMajor>, smooth::SparseJacobianBuilder<double, Eigen::RowMajor>>;
+
+TYPED_TEST_SUITE(SparseJacobian, BuildersToTest, );
+
+TYPED_TEST(SparseJacobian, Blocks)
+{
+  TypeParam builder(12, 14);
+  const auto b0 = builder.add_block(0, 0, 3, 4);
+  const auto b1 = builder.add_block(3, 2, 2, 5);
+  const auto b2 = builder.add_block(0, 12, 12, 2);
+  const auto b3 = builder.add_pattern(6, 4, smooth::d_exp_sparse_pattern<smooth::SE3d>);
+
+  ASSERT_FALSE(builder.compiled());
+  builder.compile();
+
+  ASSERT_EQ(builder.num_blocks(), 4u);
+  ASSERT_TRUE(builder.compiled());
+  ASSERT_TRUE(builder.matrix().isCompressed());
+  ASSERT_EQ(builder.matrix().nonZeros(), 12 + 10 + 24 + 27);
+  ASSERT_TRUE(Eigen::MatrixXd(builder.matrix()).isZero());
+
+  const double * const vals = builder.matrix().valuePtr();
+
+  for (auto iter = 0u; iter < 3; ++iter) {
+    const Eigen::MatrixXd A0 = Eigen::MatrixXd::Random(3, 4);
+    const Eigen::MatrixXd A1 = Eigen::MatrixXd::Random(2, 5);
+    const Eigen::MatrixXd A2 = Eigen::MatrixXd::Random(12, 2);
+
+    auto sp = smooth::d_exp_sparse_pattern<smooth::SE3d>;
+    smooth::dr_exp_sparse<smooth::SE3d>(sp, smooth::SE3d::Tangent::Random());
+
+    builder.set_block(b0, A0);
+    builder.set_block(b1, A1);
+    builder.set_block(b2, A2);
+    builder.set_block(b3, sp);
+
+    Eigen::MatrixXd expected = Eigen::MatrixXd::Zero(12, 14);
+    expected.block(0, 0, 3, 4)   = A0;
+    expected.block(3, 2, 2, 5)   = A1;
+    expected.block(0, 12, 12, 2) = A2;
+    expected.block(6, 4, 6, 6)   = Eigen::MatrixXd(sp);
+
+    ASSERT_TRUE(Eigen::MatrixXd(builder.matrix()).isApprox(expected));
+
+    // values are written in place
+    ASSERT_EQ(builder.matrix().valuePtr(), vals);
+  }
+
+  builder.setZero();
+  ASSERT_TRUE(Eigen::MatrixXd(builder.matrix()).isZero());
+  ASSERT_EQ(builder.matrix().nonZeros(), 12 + 10 + 24 + 27);
+
+  // write into a copy through a const builder
+  const TypeParam & cbuilder     = builder;
+  typename TypeParam::Matrix mat = cbuilder.matrix();
+
+  const Eigen::MatrixXd A0 = Eigen::MatrixXd::Random(3, 4);
+  auto sp                  = smooth::d_exp_sparse_pattern<smooth::SE3d>;
+  smooth::dr_exp_sparse<smooth::SE3d>(sp, smooth::SE3d::Tangent::Random());
+
+  cbuilder.set_block(mat, b0, A0);
+  cbuilder.set_block(mat, b3, sp);
+
+  Eigen::MatrixXd expected   = Eigen::MatrixXd::Zero(12, 14);
+  expected.block(0, 0, 3, 4) = A0;
+  expected.block(6, 4, 6, 6) = Eigen::MatrixXd(sp);
+
+  ASSERT_TRUE(Eigen::MatrixXd(mat).isApprox(expected));
+  ASSERT_TRUE(Eigen::MatrixXd(cbuilder.matrix()).isZero());
+}
+
+TYPED_TEST(SparseJacobian, Threads)
+{
+  static constexpr int NumBlocks  = 200;
+  static constexpr int NumThreads = 4;
+
+  TypeParam builder(3 * NumBlocks, 2 * NumBlocks + 4);
+  for (auto i = 0; i < NumBlocks; ++i) { builder.add_block(3 * i, 2 * i, 3, 6); }
+  builder.compile();
+
+  std::vector<Eigen::Matrix<double, 3, 6>> values(NumBlocks);
+  for (auto & v : values) { v.setRandom(); }
+
+  {
+    std::vector<std::jthread> threads;
+    for (auto t = 0; t < NumThreads; ++t) {
+      threads.emplace_back([&, t] {
+        for (auto i = t; i < NumBlocks; i += NumThreads) {
+          builder.set_block(static_cast<std::size_t>(i), values[static_cast<std::size_t>(i)]);
+        }
+      });
+    }
+  }
+
+  Eigen::MatrixXd expected = Eigen::MatrixXd::Zero(3 * NumBlocks, 2 * NumBlocks + 4);
+  for (auto i = 0; i < NumBlocks; ++i) { expected.block<3, 6>(3 * i, 2 * i) = values[static_cast<std::size_t>(i)]; }
+
+  ASSERT_TRUE(Eigen::MatrixXd(builder.matrix()).isApprox(expected));
+}
@@ -242,6 +242,154 @@ TEST(Spline, CropMultiple)
   ASSERT_TRUE(c3a.empty());
 }
 
+TEST(Spline, CropLaterSegment)
+{
+  std::srand(5);
+
+  using Spline = smooth::CubicSpline<smooth::SO3d>;
+
+  Spline c = Spline::FixedCubic(smooth::SO3d::Random(), Eigen::Vector3d::Random(), Eigen::Vector3d::Random(), 2.);
+  for (auto i = 0u; i < 5; ++i) { c += Spline::ConstantVelocity(Eigen::Vector3d::Random(), 1. + i); }
+
+  // windows that start after the first segment
+  for (const auto & [ta, tb] : {std::pair{2.5, 9.}, {3.5, 5.5}, {4., 12.}, {6.2, 6.8}}) {
+    for (const bool localize : {true, false}) {
+      const auto cc = c.crop(ta, tb, localize);
+
+      ASSERT_DOUBLE_EQ(cc.t_max(), tb - ta);
+
+      const smooth::SO3d g0 = localize ? c(ta) : smooth::SO3d::Identity();
+      ASSERT_TRUE((g0 * cc.start()).isApprox(c(ta)));
+      ASSERT_TRUE((g0 * cc.end()).isApprox(c(tb)));
+
+      for (double t = ta; t < tb; t += 0.0537) { ASSERT_TRUE((g0 * cc(t - ta)).isApprox(c(t))); }
+    }
+  }
+}
+
+TEST(Spline, BatchEval)
+{
+  std::srand(5);
+
+  using Spline = smooth::CubicSpline<smooth::SO3d>;
+
+  auto c1 = Spline::FixedCubic(smooth::SO3d::Random(), Eigen::Vector3d::Random(), Eigen::Vector3d::Random(), 5.);
+  c1 += Spline::ConstantVelocity(Eigen::Vector3d::Random(), 2);
+  c1 += Spline::FixedCubic(smooth::SO3d::Random(), Eigen::Vector3d::Random(), Eigen::Vector3d::Random(), 3.);
+
+  // cropped spline with compensated segments
+  const auto c2 = c1.crop(1.5, 9);
+
+  std::vector<double> ts;
+  for (double t = -1; t < 11; t += 0.01) { ts.push_back(t); }
+  ts.push_back(c2.t_max());
+  ts.push_back(2.);  // unsorted
+  ts.push_back(0.5);
+
+  for (const auto & c : {c1, c2}) {
+    for (const std::size_t num_threads : {1u, 3u}) {
+      std::vector<smooth::SO3d> gs(ts.size());
+      std::vector<Eigen::Vector3d> vels(ts.size()), accs(ts.size());
+
+      c.eval(ts, gs, vels, accs, num_threads);
+
+      for (auto i = 0u; i < ts.size(); ++i) {
+        Eigen::Vector3d vel, acc;
+        const auto g = c(ts[i], vel, acc);
+        ASSERT_TRUE(g.isApprox(gs[i]));
+        ASSERT_TRUE(vel.isApprox(vels[i]) || (vel.isZero() && vels[i].isZero()));
+        ASSERT_TRUE(acc.isApprox(accs[i]) || (acc.isZero() && accs[i].isZero()));
+      }
+
+      // value only
+      std::vector<smooth::SO3d> gs2(ts.size());
+      c.eval(ts, gs2);
+      for (auto i = 0u; i < ts.size(); ++i) { ASSERT_TRUE(gs2[i].isApprox(gs[i])); }
+    }
+  }
+}
+
+TEST(Spline, BulkConstruct)
+{
+  std::srand(5);
+
+  using Spline = smooth::CubicSpline<smooth::SO3d>;
+
+  static constexpr auto N = 5u;
+
+  std::vector<double> dts;
+  std::vector<smooth::SO3d> gs;
+  std::vector<Eigen::Matrix3d> Vs;
+  for (auto i = 0u; i < N; ++i) {
+    dts.push_back(0.5 + i);
+    gs.push_back(smooth::SO3d::Random());
+    Vs.push_back(Eigen::Matrix3d::Random());
+  }
+  gs.push_back(smooth::SO3d::Random());
+
+  Spline c1;
+  for (auto i = 0u; i < N; ++i) { c1.concat_global(Spline(dts[i], Vs[i], gs[i])); }
+  c1.concat_global(gs.back());
+
+  const Spline c2(dts, gs, std::vector<Eigen::Matrix3d>(Vs));
+
+  ASSERT_EQ(c2.size(), N);
+  ASSERT_DOUBLE_EQ(c2.t_max(), c1.t_max());
+  ASSERT_TRUE(c2.start().isApprox(gs.front()));
+  ASSERT_TRUE(c2.end().isApprox(gs.back()));
+  ASSERT_TRUE(c2.arclength(c2.t_max()).isApprox(c1.arclength(c1.t_max())));
+
+  for (double t = -1; t < c1.t_max() + 1; t += 0.05) {
+    Eigen::Vector3d vel1, vel2, acc1, acc2;
+    ASSERT_TRUE(c1(t, vel1, acc1).isApprox(c2(t, vel2, acc2)));
+    ASSERT_TRUE(vel1.isApprox(vel2) || (vel1.isZero() && vel2.isZero()));
+    ASSERT_TRUE(acc1.isApprox(acc2) || (acc1.isZero() && acc2.isZero()));
+  }
+
+  // empty
+  const Spline c3(std::vector<double>{}, std::vector<smooth::SO3d>{gs.front()}, {});
+  ASSERT_TRUE(c3.empty());
+  ASSERT_TRUE(c3.start().isApprox(gs.front()));
+}
+
+TEST(Spline, View)
+{
+  std::srand(5);
+
+  using Spline = smooth::CubicSpline<smooth::SO3d>;
+
+  Spline c = Spline::FixedCubic(smooth::SO3d::Random(), Eigen::Vector3d::Random(), Eigen::Vector3d::Random(), 2.);
+  for (auto i = 0u; i < 5; ++i) { c += Spline::ConstantVelocity(Eigen::Vector3d::Random(), 1. + i); }
+
+  for (const auto & [ta, tb] : {std::pair{0., 100.}, {1.5, 9.}, {2., 3.}, {2.5, 2.7}, {-1., 5.}, {5., 5.}}) {
+    for (const bool localize : {true, false}) {
+      const auto v  = c.view(ta, tb, localize);
+      const auto cc = c.crop(ta, tb, localize);
+
+      ASSERT_EQ(v.empty(), cc.empty());
+      ASSERT_EQ(v.size(), cc.size());
+      ASSERT_DOUBLE_EQ(v.t_max(), cc.t_max());
+      ASSERT_TRUE(v.start().isApprox(cc.start()));
+      ASSERT_TRUE(v.end().isApprox(cc.end()));
+      if (!localize) { ASSERT_TRUE(v.start().isApprox(c(std::max(ta, 0.)))); }
+
+      // avoid evaluating at segment boundaries where the velocity is discontinuous
+      for (double t = -0.5; t < v.t_max() + 0.5; t += 0.0537) {
+        Eigen::Vector3d vel1, acc1, vel2, acc2;
+        const auto g1 = v(t, vel1, acc1);
+        const auto g2 = cc(t, vel2, acc2);
+        ASSERT_TRUE(g1.isApprox(g2));
+        ASSERT_TRUE(vel1.isApprox(vel2) || (vel1.isZero() && vel2.isZero()));
+        ASSERT_TRUE(acc1.isApprox(acc2) || (acc1.isZero() && acc2.isZero()));
+      }
+
+      const auto cv = v.to_spline();
+      ASSERT_EQ(cv.size(), cc.size());
+      ASSERT_TRUE(cv.end().isApprox(cc.end()));
+    }
+  }
+}
+
 TEST(Spline, ExtendCropped)
 {
   smooth::SO3d g1 = smooth::SO3d::Random(), g2 = smooth::SO3d::Random();
@@ -333,6 +481,75 @@ TEST(Spline, ArcLengthNonConstant)
   ASSERT_NEAR(c.arclength(c.t_max()).y(), 1.1547, 1e-4);
 }
 
+TEST(Spline, ArcLengthTable)
+{
+  std::srand(5);
+
+  using Spline = smooth::CubicSpline<smooth::SO3d>;
+
+  Spline c;
+  for (auto i = 0u; i < 10; ++i) {
+    c += Spline::FixedCubic(smooth::SO3d::Random(), Eigen::Vector3d::Random(), Eigen::Vector3d::Random(), 1. + i);
+  }
+  const auto c_crop = c.crop(0.5, 40);
+
+  for (const auto & cc : {c, c_crop}) {
+    // arclength is additive over segments and monotone
+    Eigen::Vector3d A_prev = Eigen::Vector3d::Zero();
+    for (double t = 0; t < cc.t_max(); t += 0.25) {
+      const Eigen::Vector3d A = cc.arclength(t);
+      ASSERT_TRUE((A.array() >= A_prev.array() - 1e-12).all());
+      A_prev = A;
+
+      const double s = A.sum();
+      ASSERT_NEAR(cc.arclength(cc.time_at_arclength(s)).sum(), s, 1e-8);
+
+      const Eigen::Vector3d w(1, 0, 2);
+      ASSERT_NEAR(w.dot(cc.arclength(cc.time_at_arclength(w.dot(A), w))), w.dot(A), 1e-8);
+    }
+
+    ASSERT_EQ(cc.time_at_arclength(-1), 0);
+    ASSERT_EQ(cc.time_at_arclength(1e6), cc.t_max());
+    ASSERT_TRUE(cc.arclength(-1).isZero());
+    ASSERT_TRUE(cc.arclength(1e6).isApprox(cc.arclength(cc.t_max())));
+  }
+
+  // table is maintained by concatenation
+  const auto c2 = c + c_crop;
+  ASSERT_TRUE(c2.arclength(c2.t_max()).isApprox(c.arclength(c.t_max()) + c_crop.arclength(c_crop.t_max())));
+}
+
+TEST(Spline, ArcLengthLinear)
+{
+  // piecewise linear with segment displacements (2, -4) and (-1, 0)
+  smooth::Spline<1, Eigen::Vector2d> c(2, Eigen::Vector2d{2, -4});
+  c += smooth::Spline<1, Eigen::Vector2d>(1, Eigen::Vector2d{-1, 0});
+
+  ASSERT_TRUE(c.arclength(c.t_max()).isApprox(Eigen::Vector2d{3, 4}));
+  ASSERT_TRUE(c.arclength(1).isApprox(Eigen::Vector2d{1, 2}));
+  ASSERT_NEAR(c.time_at_arclength(4.5), 1.5, 1e-10);
+  ASSERT_NEAR(c.time_at_arclength(6.5), 2.5, 1e-10);
+}
+
+TEST(Spline, ArcLengthStandstill)
+{
+  smooth::Spline<1, Eigen::Vector2d> c(1, Eigen::Vector2d{1, 0});
+  c += smooth::Spline<1, Eigen::Vector2d>(1, Eigen::Vector2d{0, 0});
+  c += smooth::Spline<1, Eigen::Vector2d>(1, Eigen::Vector2d{1, 0});
+
+  // arclength is flat on [1, 2], the left-most time must be returned
+  ASSERT_NEAR(c.time_at_arclength(1), 1, 1e-10);
+  ASSERT_NEAR(c.time_at_arclength(0.5), 0.5, 1e-10);
+  ASSERT_NEAR(c.time_at_arclength(1.5), 2.5, 1e-10);
+
+  // spline that stands still at the end stops at the total arclength
+  smooth::Spline<1, Eigen::Vector2d> c2(1, Eigen::Vector2d{1, 0});
+  c2 += smooth::Spline<1, Eigen::Vector2d>(1, Eigen::Vector2d{0, 0});
+
+  ASSERT_NEAR(c2.time_at_arclength(1), 1, 1e-10);
+  ASSERT_DOUBLE_EQ(c2.time_at_arclength(2), 2);
+}
+
 #ifdef ENABLE_AUTODIFF_TESTS
 
 TEST(Spline, Autodiff)
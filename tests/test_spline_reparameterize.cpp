@@ -164,3 +164,22 @@ TEST(Spline, ReparameterizeTurnInPlace)
     ASSERT_GE((vmax - repar_vel).minCoeff(), -0.05);
   }
 }
+
+TEST(Spline, ReparameterizeView)
+{
+  smooth::CubicSpline<smooth::SE2d> c;
+  c += smooth::CubicSpline<smooth::SE2d>::ConstantVelocity(Eigen::Vector3d(1, 0, 0));
+  c += smooth::CubicSpline<smooth::SE2d>::ConstantVelocity(Eigen::Vector3d(1, 0, 1));
+  c += smooth::CubicSpline<smooth::SE2d>::ConstantVelocity(Eigen::Vector3d(1, 0, 0));
+
+  const auto v = c.view(0.5, 2.5);
+  static_assert(smooth::SplineLike<decltype(v)>);
+
+  Eigen::Vector3d vmax(1, 1, 1), amax(1, 1, 1);
+
+  const auto sfun1 = smooth::reparameterize_spline(v, -vmax, vmax, -amax, amax, 1, 1);
+  const auto sfun2 = smooth::reparameterize_spline(c.crop(0.5, 2.5), -vmax, vmax, -amax, amax, 1, 1);
+
+  ASSERT_NEAR(sfun1.t_max(), sfun2.t_max(), 1e-9);
+  for (double t = 0; t < sfun1.t_max(); t += 0.1) { ASSERT_NEAR(sfun1(t), sfun2(t), 1e-9); }
+}